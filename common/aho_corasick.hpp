@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+namespace common {
+
+// Aho-Corasick automaton over a set of byte strings, the patterns, which finds all their
+// occurrences in a text in a single pass, overlapping ones included.
+//
+// The automaton is a complete DFA: the failure links are folded into the transitions at
+// construction, so that reading a character is a single table lookup. The alphabet is restricted to
+// the bytes of the patterns, the other ones all leading back to the root, so that the table takes
+// a row of one state per distinct byte of the patterns for every node of their trie.
+class AhoCorasick {
+ public:
+  using State = std::uint32_t;
+
+  static constexpr State root = 0U;
+
+  // Patterns are ranges of characters, of which the empty ones never match
+  template <std::ranges::input_range Patterns>
+  explicit AhoCorasick(Patterns&& patterns) {
+    std::vector<std::vector<char>> pattern_texts;
+    for (auto&& pattern : patterns) {
+      pattern_texts.push_back(pattern | std::ranges::to<std::vector<char>>());
+    }
+
+    for (const auto& pattern : pattern_texts) {
+      for (const char c : pattern) {
+        auto& symbol = symbols_[std::uint8_t(c)];
+        if (symbol == 0U) {
+          symbol = Symbol(alphabet_size_++);
+        }
+      }
+    }
+
+    add_state();
+    for (const auto& pattern : pattern_texts) {
+      if (pattern.empty()) {
+        continue;
+      }
+      State state = root;
+      for (const char c : pattern) {
+        const std::size_t transition = transition_index(state, c);
+        if (transitions_[transition] == root) {
+          const State child = add_state();
+          transitions_[transition] = child;
+        }
+        state = transitions_[transition];
+      }
+      ++match_counts_[state];
+      longest_matches_[state] = std::max(longest_matches_[state], pattern.size());
+    }
+
+    link_failures();
+  }
+
+  auto next(const State state, const char c) const -> State {
+    return transitions_[transition_index(state, c)];
+  }
+
+  // Number of patterns, counted with their multiplicity, that are suffixes of the text read up to
+  // the state
+  auto match_count(const State state) const -> std::size_t { return match_counts_[state]; }
+
+  // Length of the longest pattern that is a suffix of the text read up to the state, or 0
+  auto longest_match(const State state) const -> std::size_t { return longest_matches_[state]; }
+
+  auto state_count() const -> std::size_t { return match_counts_.size(); }
+
+ private:
+  using Symbol = std::uint16_t;
+
+  auto transition_index(const State state, const char c) const -> std::size_t {
+    return (std::size_t(state) * alphabet_size_) + symbols_[std::uint8_t(c)];
+  }
+
+  auto add_state() -> State {
+    const auto result = State(match_counts_.size());
+    transitions_.resize(transitions_.size() + alphabet_size_, root);
+    match_counts_.push_back(0UZ);
+    longest_matches_.push_back(0UZ);
+    return result;
+  }
+
+  // Breadth-first over the trie, so that the failure state of every state is complete when the
+  // state is reached: missing transitions are those of the failure state, and matches include its
+  // own, as its text is a suffix of the text of the state
+  void link_failures() {
+    std::vector<State> failures(state_count(), root);
+    std::vector<State> queue;
+    for (std::size_t symbol = 0UZ; symbol < alphabet_size_; ++symbol) {
+      if (const State child = transitions_[symbol]; child != root) {
+        queue.push_back(child);
+      }
+    }
+
+    for (std::size_t rank = 0UZ; rank < queue.size(); ++rank) {
+      const State state = queue[rank];
+      const State failure = failures[state];
+      match_counts_[state] += match_counts_[failure];
+      longest_matches_[state] = std::max(longest_matches_[state], longest_matches_[failure]);
+
+      const std::size_t row = std::size_t(state) * alphabet_size_;
+      const std::size_t failure_row = std::size_t(failure) * alphabet_size_;
+      // Symbol 0 stands for the bytes of no pattern, which always lead back to the root
+      for (std::size_t symbol = 1UZ; symbol < alphabet_size_; ++symbol) {
+        const State child = transitions_[row + symbol];
+        if (child == root) {
+          transitions_[row + symbol] = transitions_[failure_row + symbol];
+        } else {
+          failures[child] = transitions_[failure_row + symbol];
+          queue.push_back(child);
+        }
+      }
+    }
+  }
+
+  std::array<Symbol, 256> symbols_{};
+  std::size_t alphabet_size_{1UZ};
+  std::vector<State> transitions_;
+  std::vector<std::size_t> match_counts_;
+  std::vector<std::size_t> longest_matches_;
+};
+
+}  // namespace common
@@ -0,0 +1,124 @@
+#include "common/allocations.hpp"
+
+#include <fcntl.h>
+#include <malloc.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+namespace {
+
+std::atomic<std::size_t> allocation_count;
+std::atomic<std::size_t> allocated_bytes;
+std::atomic<std::size_t> live_bytes;
+std::atomic<std::size_t> peak_bytes;
+
+#if defined(ENABLE_ALLOCATION_STATS)
+
+// Sizes are accounted as the usable sizes of the blocks, which the deallocation can find again
+auto track(void* pointer) -> void* {
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  const std::size_t size = malloc_usable_size(pointer);
+  allocation_count.fetch_add(1UZ, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  const std::size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  std::size_t peak = peak_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+
+  return pointer;
+}
+
+void release(void* pointer) {
+  if (pointer != nullptr) {
+    live_bytes.fetch_sub(malloc_usable_size(pointer), std::memory_order_relaxed);
+    std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+  }
+}
+
+#endif
+
+}  // namespace
+
+#if defined(ENABLE_ALLOCATION_STATS)
+
+// The other forms of operator new and delete (array, sized and nothrow ones) forward to these
+// ones in libstdc++
+
+auto operator new(const std::size_t size) -> void* {
+  return track(std::malloc(std::max(size, 1UZ)));  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+auto operator new(const std::size_t size, const std::align_val_t alignment) -> void* {
+  // The size given to aligned_alloc must be a multiple of the alignment
+  const auto align = std::size_t(alignment);
+  return track(std::aligned_alloc(align, ((std::max(size, 1UZ) + align - 1UZ) / align) * align));
+}
+
+void operator delete(void* pointer) noexcept { release(pointer); }
+
+void operator delete(void* pointer, std::align_val_t /*alignment*/) noexcept { release(pointer); }
+
+#endif
+
+namespace common::allocations {
+
+auto counters() -> Counters {
+  return {.count = allocation_count.load(std::memory_order_relaxed),
+          .bytes = allocated_bytes.load(std::memory_order_relaxed),
+          .live_bytes = live_bytes.load(std::memory_order_relaxed)};
+}
+
+// Neither function allocates through operator new, so as not to disturb the measurements
+
+void reset_peaks() {
+  peak_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+  // Writing 5 resets the peak resident set size on Linux, when permitted
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const int fd = ::open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+  if (fd >= 0) {
+    [[maybe_unused]] const auto written = ::write(fd, "5", 1UZ);
+    ::close(fd);
+  }
+}
+
+auto peak_live_bytes() -> std::size_t { return peak_bytes.load(std::memory_order_relaxed); }
+
+auto peak_rss() -> std::size_t {
+  constexpr std::size_t kibibyte = 1024UZ;
+
+  if (std::FILE* const status = std::fopen("/proc/self/status", "r")) {
+    std::array<char, 256> line{};
+    std::size_t result{};
+    while (std::fgets(line.data(), int(line.size()), status) != nullptr) {
+      const std::string_view text{line.data()};
+      if (text.starts_with("VmHWM:")) {
+        // NOLINTNEXTLINE(cert-err34-c)
+        result = std::strtoull(line.data() + text.find_first_of("0123456789"), nullptr, 10);
+        break;
+      }
+    }
+    std::fclose(status);
+    if (result != 0UZ) {
+      return result * kibibyte;
+    }
+  }
+
+  rusage usage{};
+  ::getrusage(RUSAGE_SELF, &usage);
+  return std::size_t(usage.ru_maxrss) * kibibyte;
+}
+
+}  // namespace common::allocations
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+namespace common::allocations {
+
+// Whether the global operator new and delete are hooked to count allocations, which the
+// ENABLE_ALLOCATION_STATS CMake option turns on
+#if defined(ENABLE_ALLOCATION_STATS)
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+struct Statistics {
+  std::size_t count;       // Number of allocations
+  std::size_t bytes;       // Total size of the allocations
+  std::size_t peak_bytes;  // Peak size of the live allocations, above the initial level
+  std::size_t peak_rss;    // Peak resident set size of the process, in bytes
+};
+
+struct Counters {
+  std::size_t count;
+  std::size_t bytes;
+  std::size_t live_bytes;
+};
+
+auto counters() -> Counters;
+
+// Restarts the peak measurements of the live allocations and of the resident set
+void reset_peaks();
+
+auto peak_live_bytes() -> std::size_t;
+auto peak_rss() -> std::size_t;
+
+// Allocation statistics from construction on. Scopes must not overlap, and allocations from
+// other threads are counted as well.
+class Scope {
+ public:
+  Scope() : initial_(counters()) { reset_peaks(); }
+
+  auto statistics() const -> Statistics {
+    const auto current = counters();
+    const auto peak = peak_live_bytes();
+    return {.count = current.count - initial_.count,
+            .bytes = current.bytes - initial_.bytes,
+            .peak_bytes = peak > initial_.live_bytes ? peak - initial_.live_bytes : 0UZ,
+            .peak_rss = peak_rss()};
+  }
+
+ private:
+  Counters initial_;
+};
+
+}  // namespace common::allocations
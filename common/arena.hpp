@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace common {
+
+// Scratch memory for the containers that a solver rebuilds at every round of an iteration.
+// The blocks released by a round are recycled by the next ones, and fresh blocks are carved out of
+// large chunks, so that most allocations pop a free list or bump a pointer instead of calling
+// malloc. The memory is only returned when the arena is destroyed. Not thread-safe.
+class Arena : public std::pmr::unsynchronized_pool_resource {
+ public:
+  // Blocks up to this size are pooled, which covers the frontiers of the breadth-first searches
+  static constexpr std::size_t largest_pooled_block = 1UZ << 20U;
+
+  Arena()
+      : unsynchronized_pool_resource{std::pmr::pool_options{
+            .max_blocks_per_chunk = 0UZ, .largest_required_pool_block = largest_pooled_block}} {}
+};
+
+}  // namespace common
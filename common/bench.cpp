@@ -0,0 +1,485 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "common/allocations.hpp"
+#include "common/checkpoint.hpp"
+#include "common/input.hpp"
+#include "common/perf_events.hpp"
+#include "common/quest.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Nanoseconds = std::chrono::nanoseconds;
+
+struct Options {
+  std::size_t warmup_count{1UZ};
+  std::size_t repetition_count{10UZ};
+  std::optional<std::string> json_path;
+  bool accumulate{};
+  std::optional<std::string> baseline_path;
+  std::size_t threshold_percent{10UZ};
+  bool count_events{};
+  common::CheckpointSettings checkpoints;
+};
+
+constexpr std::string_view usage =
+    "Usage: bench [--warmup N] [--repetitions N] [--json PATH] [--accumulate] [--baseline PATH]\n"
+    "             [--threshold PERCENT] [--counters] [--checkpoint DIR]\n"
+    "             [--checkpoint-interval SECONDS]\n"
+    "\n"
+    "Times the parsing and the solving of every part separately, over N repetitions\n"
+    "preceded by warmup runs, and reports the min, median and 99th percentile.\n"
+    "When built with ENABLE_ALLOCATION_STATS, also reports the allocations of a first run.\n"
+    "With --counters, also reports the hardware events of the repetitions, per run, as far as\n"
+    "perf_event_open can count them.\n"
+    "With --accumulate, the JSON output also keeps the slowest median of every phase over the\n"
+    "runs previously written to PATH, so as to record how much the machine drifts between runs.\n"
+    "Given the JSON output of previous runs, fails when both the median and the min durations\n"
+    "of a phase exceed its slowest previous median by more than PERCENT (10 by default), and\n"
+    "its previous 99th percentile, or when a part cannot be read or a phase is missing from\n"
+    "either run.\n"
+    "With --checkpoint, the longest searches save their state into DIR every SECONDS, so as to\n"
+    "measure the cost of the checkpoints.";
+
+auto parse_count(const std::string_view text) -> std::optional<std::size_t> {
+  std::size_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  Options result;
+
+  for (auto arg_it = args.begin(); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    const auto value = [&]() -> std::optional<std::string_view> {
+      if (std::next(arg_it) == args.end()) {
+        return {};
+      }
+      return *++arg_it;
+    };
+
+    if (arg == "--warmup") {
+      const auto count = value().and_then(parse_count);
+      if (!count) {
+        return {};
+      }
+      result.warmup_count = *count;
+    } else if (arg == "--repetitions") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.repetition_count = *count;
+    } else if (arg == "--json") {
+      const auto path = value();
+      if (!path) {
+        return {};
+      }
+      result.json_path = std::string{*path};
+    } else if (arg == "--accumulate") {
+      result.accumulate = true;
+    } else if (arg == "--baseline") {
+      const auto path = value();
+      if (!path) {
+        return {};
+      }
+      result.baseline_path = std::string{*path};
+    } else if (arg == "--threshold") {
+      const auto percent = value().and_then(parse_count);
+      if (!percent) {
+        return {};
+      }
+      result.threshold_percent = *percent;
+    } else if (arg == "--counters") {
+      result.count_events = true;
+    } else if (arg == "--checkpoint") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.checkpoints.directory = *directory;
+    } else if (arg == "--checkpoint-interval") {
+      const auto seconds = value().and_then(parse_count);
+      if (!seconds) {
+        return {};
+      }
+      result.checkpoints.interval = std::chrono::seconds(*seconds);
+    } else {
+      return {};
+    }
+  }
+
+  return result;
+}
+
+struct Statistics {
+  Nanoseconds min;
+  Nanoseconds median;
+  Nanoseconds p99;
+};
+
+// Nearest-rank percentile of sorted samples
+auto percentile(const std::span<const Nanoseconds> samples, const double fraction) -> Nanoseconds {
+  const auto rank = std::size_t(std::ceil(fraction * double(samples.size())));
+  return samples[std::clamp(rank, 1UZ, samples.size()) - 1UZ];
+}
+
+auto measure(const Options& options, const auto& run) -> Statistics {
+  for (auto _ : std::views::iota(0UZ, options.warmup_count)) {
+    run();
+  }
+
+  std::vector<Nanoseconds> samples;
+  samples.reserve(options.repetition_count);
+  for (auto _ : std::views::iota(0UZ, options.repetition_count)) {
+    const auto start = Clock::now();
+    run();
+    samples.push_back(Clock::now() - start);
+  }
+
+  std::ranges::sort(samples);
+  return {.min = samples.front(),
+          .median = percentile(samples, 0.5),
+          .p99 = percentile(samples, 0.99)};
+}
+
+// Allocations of a single run, made before the timed ones so as to observe the cold peak RSS
+auto track_allocations(const auto& run) -> std::optional<common::allocations::Statistics> {
+  if constexpr (common::allocations::enabled) {
+    const common::allocations::Scope scope;
+    run();
+    return scope.statistics();
+  } else {
+    return {};
+  }
+}
+
+// Hardware events of the repetitions of a run, made after the timed ones so as not to disturb them
+auto count_events(const Options& options, const auto& run, common::perf::Counters* const counters)
+    -> std::optional<common::perf::Readings> {
+  if (counters == nullptr) {
+    return {};
+  }
+  counters->start();
+  for (auto _ : std::views::iota(0UZ, options.repetition_count)) {
+    run();
+  }
+  auto result = counters->stop();
+  for (auto& reading : result) {
+    reading = reading.transform(
+        [&](const std::uint64_t count) { return count / options.repetition_count; });
+  }
+  return result;
+}
+
+struct Measurement {
+  std::string quest;
+  std::size_t part;
+  std::string_view phase;
+  std::size_t input_bytes;  // Total size of the input files of the part
+  Statistics statistics;
+  std::optional<common::allocations::Statistics> allocations;
+  std::optional<common::perf::Readings> events;
+};
+
+auto microseconds(const Nanoseconds duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+auto kibibytes(const std::size_t bytes) { return double(bytes) / 1024.0; }
+
+// Bytes per nanosecond are gigabytes per second
+auto gigabytes_per_second(const std::size_t bytes, const Nanoseconds duration) {
+  return double(bytes) / double(std::max(duration.count(), Nanoseconds::rep{1}));
+}
+
+void report(const Measurement& measurement) {
+  const auto& [quest, part, phase, input_bytes, statistics, allocations, events] = measurement;
+  std::println(
+      "{} part #{} {:<5}  min {:>12.3f} us  median {:>12.3f} us  p99 {:>12.3f} us  {:>8.3f} GB/s",
+      quest, part, phase, microseconds(statistics.min), microseconds(statistics.median),
+      microseconds(statistics.p99), gigabytes_per_second(input_bytes, statistics.median));
+  if (allocations) {
+    std::println("{} part #{} {:<5}  allocations {:>10}  bytes {:>14}  peak {:>12.1f} KiB  "
+                 "peak RSS {:>12.1f} KiB",
+                 quest, part, phase, allocations->count, allocations->bytes,
+                 kibibytes(allocations->peak_bytes), kibibytes(allocations->peak_rss));
+  }
+  if (events) {
+    std::string line = std::format("{} part #{} {:<5}", quest, part, phase);
+    for (const auto& [event, reading] : std::views::zip(common::perf::all_events, *events)) {
+      std::format_to(std::back_inserter(line), "  {} {:>12}", common::perf::name(event),
+                     reading ? std::format("{}", *reading) : "-");
+    }
+    const auto& cycles = (*events)[std::to_underlying(common::perf::Event::cycles)];
+    const auto& instructions = (*events)[std::to_underlying(common::perf::Event::instructions)];
+    if (cycles && instructions && *cycles != 0U) {
+      std::format_to(std::back_inserter(line), "  IPC {:.2f}",
+                     double(*instructions) / double(*cycles));
+    }
+    std::println("{}", line);
+  }
+}
+
+// Value of `key` in a measurement line written by `write_json`
+auto json_field(const std::string_view line, const std::string_view key)
+    -> std::optional<std::string_view> {
+  const auto tag = std::format("\"{}\": ", key);
+  const auto position = line.find(tag);
+  if (position == std::string_view::npos) {
+    return {};
+  }
+  const auto value = line.substr(position + tag.size());
+  if (value.starts_with('"')) {
+    return value.substr(1UZ, value.find('"', 1UZ) - 1UZ);
+  }
+  return value.substr(0UZ, value.find_first_of(",}"));
+}
+
+struct BaselineMeasurement {
+  std::string quest;
+  std::size_t part;
+  std::string phase;
+  Statistics statistics;
+  // Slowest median over the runs accumulated into the baseline
+  Nanoseconds slowest_median;
+};
+
+auto read_baseline(const std::string& path) -> std::optional<std::vector<BaselineMeasurement>> {
+  std::ifstream in{path};
+  if (!in) {
+    return {};
+  }
+
+  std::vector<BaselineMeasurement> result;
+  for (std::string line; std::getline(in, line);) {
+    const auto quest = json_field(line, "quest");
+    const auto part = json_field(line, "part").and_then(parse_count);
+    const auto phase = json_field(line, "phase");
+    const auto min = json_field(line, "min_ns").and_then(parse_count);
+    const auto median = json_field(line, "median_ns").and_then(parse_count);
+    const auto p99 = json_field(line, "p99_ns").and_then(parse_count);
+    const auto slowest_median = json_field(line, "slowest_median_ns").and_then(parse_count);
+    if (quest && part && phase && min && median && p99) {
+      result.push_back({.quest = std::string{*quest},
+                        .part = *part,
+                        .phase = std::string{*phase},
+                        .statistics = {.min = Nanoseconds(*min),
+                                       .median = Nanoseconds(*median),
+                                       .p99 = Nanoseconds(*p99)},
+                        .slowest_median = Nanoseconds(slowest_median.value_or(*median))});
+    }
+  }
+  return result;
+}
+
+auto find_baseline(const std::span<const BaselineMeasurement> baseline,
+                   const std::string_view quest, const std::size_t part,
+                   const std::string_view phase) -> const BaselineMeasurement* {
+  const auto found = std::ranges::find_if(baseline, [&](const auto& candidate) {
+    return candidate.quest == quest && candidate.part == part && candidate.phase == phase;
+  });
+  return found == baseline.end() ? nullptr : &*found;
+}
+
+// The slowest medians are those of `previous` when slower
+auto write_json(const Options& options, const std::span<const Measurement> measurements,
+                const std::span<const BaselineMeasurement> previous, std::ostream& out) {
+  std::println(out, "{{");
+  std::println(out, "  \"warmup\": {},", options.warmup_count);
+  std::println(out, "  \"repetitions\": {},", options.repetition_count);
+  std::println(out, "  \"measurements\": [");
+  for (const auto& [rank, measurement] : std::views::enumerate(measurements)) {
+    const auto& [quest, part, phase, input_bytes, statistics, allocations, events] = measurement;
+    const auto allocation_fields =
+        allocations ? std::format(", \"allocations\": {}, \"allocated_bytes\": {}, "
+                                  "\"peak_live_bytes\": {}, \"peak_rss_bytes\": {}",
+                                  allocations->count, allocations->bytes, allocations->peak_bytes,
+                                  allocations->peak_rss)
+                    : std::string{};
+    std::string event_fields;
+    for (const auto& [event, reading] :
+         std::views::zip(common::perf::all_events, events.value_or(common::perf::Readings{}))) {
+      if (reading) {
+        auto key = std::string{common::perf::name(event)};
+        std::ranges::replace(key, ' ', '_');
+        std::format_to(std::back_inserter(event_fields), ", \"{}\": {}", key, *reading);
+      }
+    }
+    const auto* const previous_measurement = find_baseline(previous, quest, part, phase);
+    const auto slowest_median =
+        previous_measurement != nullptr
+            ? std::max(statistics.median, previous_measurement->slowest_median)
+            : statistics.median;
+    std::println(out,
+                 "    {{\"quest\": \"{}\", \"part\": {}, \"phase\": \"{}\", \"input_bytes\": {}, "
+                 "\"min_ns\": {}, \"median_ns\": {}, \"p99_ns\": {}, \"slowest_median_ns\": {}"
+                 "{}{}}}{}",
+                 quest, part, phase, input_bytes, statistics.min.count(),
+                 statistics.median.count(), statistics.p99.count(), slowest_median.count(),
+                 allocation_fields, event_fields,
+                 std::size_t(rank) + 1UZ < measurements.size() ? "," : "");
+  }
+  std::println(out, "  ]");
+  std::println(out, "}}");
+}
+
+// Slowdowns below this duration are ignored, as they are within the noise of the measurements
+constexpr Nanoseconds noise_floor = std::chrono::microseconds{50};
+
+// Compares the measurements to the baseline and tells whether none has regressed. A phase regresses
+// when even its min duration exceeds the slowest baseline median beyond the threshold, so that
+// neither disturbed repetitions nor a machine slower than when the baseline was measured are
+// reported as regressions, and beyond the baseline p99, so that the phases whose repetitions
+// spread wider than the threshold are only held to their own noise.
+auto compare(const Options& options, const std::span<const Measurement> measurements,
+             const std::span<const BaselineMeasurement> baseline) -> bool {
+  const double tolerance = 1.0 + (double(options.threshold_percent) / 100.0);
+  const auto regressed = [&](const Nanoseconds current, const BaselineMeasurement& reference) {
+    return double(current.count()) > double(reference.slowest_median.count()) * tolerance &&
+           current > reference.statistics.p99 &&
+           current - reference.slowest_median > noise_floor;
+  };
+
+  bool result = true;
+  for (const auto& [quest, part, phase, input_bytes, statistics, allocations, events] :
+       measurements) {
+    const auto* const reference = find_baseline(baseline, quest, part, phase);
+    if (reference == nullptr) {
+      std::println("{} part #{} {:<5}  no baseline  MISSING", quest, part, phase);
+      result = false;
+      continue;
+    }
+    const auto change = (double(statistics.median.count()) /
+                         double(reference->slowest_median.count())) - 1.0;
+    const bool regression =
+        regressed(statistics.median, *reference) && regressed(statistics.min, *reference);
+    std::println("{} part #{} {:<5}  median {:>+8.1f}% over slowest baseline{}", quest, part, phase,
+                 100.0 * change, regression ? "  REGRESSION" : "");
+    result = result && !regression;
+  }
+
+  // Phases of the baseline that were not measured, e.g. as they were renamed
+  for (const auto& [quest, part, phase, statistics, slowest_median] : baseline) {
+    const bool measured = std::ranges::any_of(measurements, [&](const Measurement& measurement) {
+      return measurement.quest == quest && measurement.part == part && measurement.phase == phase;
+    });
+    if (!measured) {
+      std::println("{} part #{} {:<5}  not measured  MISSING", quest, part, phase);
+      result = false;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    return EXIT_FAILURE;
+  }
+  common::checkpoint_settings() = options->checkpoints;
+
+  // The events of the threads of the parallel loops are not counted, unless PARALLEL_THREADS is 1
+  std::optional<common::perf::Counters> counters;
+  if (options->count_events) {
+    counters.emplace();
+    if (!counters->available()) {
+      std::println(stderr, "Hardware counters unavailable: {}", counters->error());
+      counters.reset();
+    }
+  }
+  common::perf::Counters* const counters_pointer = counters ? &*counters : nullptr;
+
+  std::vector<Measurement> measurements;
+  bool skipped_parts{};
+
+  for (const auto& quest : common::registry()) {
+    for (const auto& [rank, part] : std::views::enumerate(quest.parts)) {
+      const std::size_t part_number = std::size_t(rank) + 1UZ;
+
+      const auto inputs = common::Inputs::load(part.files);
+      if (!inputs) {
+        std::println(stderr, "Skipping {} part #{}: cannot read {}", quest.name, part_number,
+                     inputs.error());
+        skipped_parts = true;
+        continue;
+      }
+
+      const std::size_t input_bytes =
+          std::ranges::fold_left(inputs->sources(), 0UZ,
+                                 [](const std::size_t size, const std::string_view source) {
+                                   return size + source.size();
+                                 });
+
+      const auto parse = [&]() { return part.parse(inputs->sources()); };
+      const auto parse_allocations = track_allocations(parse);
+      const auto parse_statistics = measure(*options, parse);
+      const auto parse_events = count_events(*options, parse, counters_pointer);
+      measurements.push_back(
+          {quest.name, part_number, "parse", input_bytes, parse_statistics, parse_allocations,
+           parse_events});
+      report(measurements.back());
+
+      const auto input = parse();
+      const auto solve = [&]() { return part.solve(input); };
+      const auto solve_allocations = track_allocations(solve);
+      const auto solve_statistics = measure(*options, solve);
+      const auto solve_events = count_events(*options, solve, counters_pointer);
+      measurements.push_back(
+          {quest.name, part_number, "solve", input_bytes, solve_statistics, solve_allocations,
+           solve_events});
+      report(measurements.back());
+    }
+  }
+
+  if (options->json_path) {
+    const auto previous = options->accumulate ? read_baseline(*options->json_path) : std::nullopt;
+    std::ofstream out{*options->json_path};
+    if (!out) {
+      std::println(stderr, "Cannot write {}", *options->json_path);
+      return EXIT_FAILURE;
+    }
+    write_json(*options, measurements, previous.value_or(std::vector<BaselineMeasurement>{}), out);
+  }
+
+  if (options->baseline_path) {
+    const auto baseline = read_baseline(*options->baseline_path);
+    if (!baseline) {
+      std::println(stderr, "Cannot read {}", *options->baseline_path);
+      return EXIT_FAILURE;
+    }
+    // The parts that could not be measured cannot be checked either
+    if (!compare(*options, measurements, *baseline) || skipped_parts) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
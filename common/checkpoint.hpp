@@ -0,0 +1,207 @@
+#pragma once
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace common {
+
+struct CheckpointSettings {
+  // Directory of the checkpoint files, none disabling the checkpoints
+  std::optional<std::filesystem::path> directory;
+  // Whether the solvers resume from the checkpoints found in the directory
+  bool resume{};
+  std::chrono::seconds interval{60};
+};
+
+// Settings of the checkpoints of the current process, set by the drivers before solving
+inline auto checkpoint_settings() -> CheckpointSettings& {
+  static CheckpointSettings settings;
+  return settings;
+}
+
+// Binary encoding of the state of a solver, as the raw bytes of trivially copyable values and of
+// sequences of them prefixed by their length. Checkpoints are read back by the same executable.
+class StateWriter {
+ public:
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void write(const T& value) {
+    const auto* const bytes = reinterpret_cast<const char*>(&value);  // NOLINT
+    bytes_.append(bytes, sizeof(T));
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void write(const std::vector<T>& values) {
+    write(std::uint64_t(values.size()));
+    const auto* const bytes = reinterpret_cast<const char*>(values.data());  // NOLINT
+    bytes_.append(bytes, values.size() * sizeof(T));
+  }
+
+  auto bytes() const -> std::string_view { return bytes_; }
+
+ private:
+  std::string bytes_;
+};
+
+// Decoding of the bytes of a `StateWriter`, every read failing once the bytes are exhausted
+class StateReader {
+ public:
+  explicit StateReader(const std::string_view bytes) : bytes_(bytes) {}
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  auto read(T& value) -> bool {
+    if (bytes_.size() < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, bytes_.data(), sizeof(T));
+    bytes_.remove_prefix(sizeof(T));
+    return true;
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  auto read(std::vector<T>& values) -> bool {
+    std::uint64_t size{};
+    if (!read(size) || size > bytes_.size() / sizeof(T)) {
+      return false;
+    }
+    values.resize(size);
+    std::memcpy(values.data(), bytes_.data(), size * sizeof(T));
+    bytes_.remove_prefix(size * sizeof(T));
+    return true;
+  }
+
+  auto done() const -> bool { return bytes_.empty(); }
+
+ private:
+  std::string_view bytes_;
+};
+
+// Periodic checkpoints of a long-running loop, which is named after the part it solves and
+// identified by a digest of its input, so that a checkpoint is only resumed on the same input.
+//
+// The loop asks whether a checkpoint is `due()` at every iteration, which only reads the clock
+// every `clock_stride` calls, and then saves its state. Saving writes a temporary file renamed over
+// the previous checkpoint, so that a crash while saving leaves the previous one intact.
+class Checkpoint {
+ public:
+  Checkpoint(const std::string_view name, const std::uint64_t input_digest)
+      : settings_(checkpoint_settings()), input_digest_(input_digest) {
+    if (settings_.directory) {
+      path_ = *settings_.directory / std::format("{}-{:016x}.ckpt", name, input_digest);
+      deadline_ = Clock::now() + settings_.interval;
+    }
+  }
+
+  auto enabled() const -> bool { return !path_.empty(); }
+
+  // State saved by a previous run on the same input, when resuming
+  auto load() const -> std::optional<std::string> {
+    if (!enabled() || !settings_.resume) {
+      return {};
+    }
+    std::ifstream file{path_, std::ios::binary};
+    if (!file) {
+      return {};
+    }
+    std::string contents{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    if (contents.size() < header_size) {
+      return {};
+    }
+    Header header{};
+    std::memcpy(&header, contents.data(), header_size);
+    if (header.magic != magic || header.input_digest != input_digest_) {
+      return {};
+    }
+    return contents.substr(header_size);
+  }
+
+  // Whether the loop should save its state now
+  auto due() -> bool {
+    if (!enabled() || ++call_count_ % clock_stride != 0UZ) {
+      return false;
+    }
+    const auto now = Clock::now();
+    if (now < deadline_) {
+      return false;
+    }
+    deadline_ = now + settings_.interval;
+    return true;
+  }
+
+  // Whether the state could be written. Every save writes its own temporary file, renamed into
+  // place, as the identical inputs solved concurrently share their checkpoint.
+  auto save(const StateWriter& state) const -> bool {
+    if (!enabled()) {
+      return false;
+    }
+    const Header header{.magic = magic, .input_digest = input_digest_};
+    auto temporary_path = path_;
+    temporary_path += std::format(".{}-{:x}.tmp", ::getpid(),
+                                  std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    std::error_code error;
+    {
+      std::ofstream file{temporary_path, std::ios::binary | std::ios::trunc};
+      file.write(reinterpret_cast<const char*>(&header), header_size);  // NOLINT
+      file.write(state.bytes().data(), std::streamsize(state.bytes().size()));
+      if (!file.flush()) {
+        file.close();
+        std::filesystem::remove(temporary_path, error);
+        return false;
+      }
+    }
+    std::filesystem::rename(temporary_path, path_, error);
+    if (error) {
+      std::filesystem::remove(temporary_path, error);
+      return false;
+    }
+    return true;
+  }
+
+  // Discards the checkpoint once the loop is over
+  void remove() const {
+    if (enabled()) {
+      std::error_code error;
+      std::filesystem::remove(path_, error);
+    }
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Header {
+    std::array<char, 8> magic;
+    std::uint64_t input_digest;
+  };
+
+  static constexpr std::array<char, 8> magic{'E', 'C', 'C', 'K', 'P', 'T', '0', '1'};
+  static constexpr std::size_t header_size = sizeof(Header);
+  static constexpr std::size_t clock_stride = 1024UZ;
+
+  const CheckpointSettings& settings_;
+  std::uint64_t input_digest_;
+  std::filesystem::path path_;
+  Clock::time_point deadline_;
+  std::size_t call_count_{};
+};
+
+}  // namespace common
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory_resource>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace common {
+
+// Coordinates of `loc` packed into 64 bits, each of them in two's complement over 64 / N bits
+template <typename Coord, std::size_t n>
+constexpr auto pack_coords(const std::array<Coord, n>& loc) -> std::uint64_t {
+  static_assert(std::is_integral_v<Coord> && n != 0UZ && n <= 64UZ);
+  constexpr unsigned width = 64U / unsigned(n);
+  if constexpr (n == 1UZ) {
+    return std::uint64_t(loc[0]);
+  } else {
+    constexpr std::int64_t limit = std::int64_t{1} << (width - 1U);
+    constexpr std::uint64_t mask = (std::uint64_t{1} << width) - 1U;
+    std::uint64_t result{};
+    for (const Coord coord : loc) {
+      assert(std::int64_t(coord) >= -limit && std::int64_t(coord) < limit);
+      result = (result << width) | (std::uint64_t(coord) & mask);
+    }
+    return result;
+  }
+}
+
+// Whether the coordinates of `loc` fit into their bits once packed, see `pack_coords`
+template <typename Coord, std::size_t n>
+constexpr auto fits_packed(const std::array<Coord, n>& loc) -> bool {
+  if constexpr (n == 1UZ) {
+    return true;
+  } else {
+    constexpr unsigned width = 64U / unsigned(n);
+    constexpr std::int64_t limit = std::int64_t{1} << (width - 1U);
+    return std::ranges::all_of(loc, [](const Coord coord) {
+      return std::int64_t(coord) >= -limit && std::int64_t(coord) < limit;
+    });
+  }
+}
+
+// Coordinates of `loc` packed into 64 bits, throwing when they do not fit rather than aliasing
+// other locations
+template <typename Coord, std::size_t n>
+auto checked_pack_coords(const std::array<Coord, n>& loc) -> std::uint64_t {
+  if (!fits_packed(loc)) {
+    throw std::out_of_range{"coordinates out of the range of packed coordinates"};
+  }
+  return pack_coords(loc);
+}
+
+template <typename Loc>
+constexpr auto unpack_coords(std::uint64_t key) -> Loc {
+  using Coord = typename Loc::value_type;
+  constexpr std::size_t n = std::tuple_size_v<Loc>;
+  constexpr unsigned width = 64U / unsigned(n);
+  if constexpr (n == 1UZ) {
+    return {Coord(key)};
+  } else {
+    constexpr std::uint64_t mask = (std::uint64_t{1} << width) - 1U;
+    Loc result{};
+    for (auto& coord : std::views::reverse(result)) {
+      // The field is sign-extended by shifting it to the top and back
+      coord = Coord(std::int64_t((key & mask) << (64U - width)) >> (64U - width));
+      key >>= width;
+    }
+    return result;
+  }
+}
+
+namespace coords_detail {
+
+// Open-addressing hash table of packed coordinates, with linear probing.
+//
+// Besides the slots, every position has a control byte: zero when the position is empty, and
+// otherwise the top bit set along with 7 bits of the hash of the key. Probing scans the control
+// bytes, which are contiguous, and only compares the keys whose hash bits match, so that a lookup
+// usually touches one cache line of control bytes and one slot.
+template <typename Slot>
+class PackedTable {
+ public:
+  explicit PackedTable(std::pmr::memory_resource* const resource)
+      : controls_(resource), slots_(resource) {}
+
+  auto size() const -> std::size_t { return size_; }
+  auto empty() const -> bool { return size_ == 0UZ; }
+
+  void clear() {
+    std::ranges::fill(controls_, std::uint8_t{});
+    size_ = 0UZ;
+  }
+
+  void reserve(const std::size_t count) {
+    if (max_size(controls_.size()) < count) {
+      std::size_t capacity = std::max(controls_.size(), min_capacity);
+      while (max_size(capacity) < count) {
+        capacity *= 2UZ;
+      }
+      rehash(capacity);
+    }
+  }
+
+ protected:
+  static auto key_of(const Slot& slot) -> std::uint64_t {
+    if constexpr (std::is_same_v<Slot, std::uint64_t>) {
+      return slot;
+    } else {
+      return slot.first;
+    }
+  }
+
+  // Position of the key, or none
+  auto find_position(const std::uint64_t key) const -> std::size_t {
+    if (size_ == 0UZ) {
+      return none;
+    }
+    const std::uint64_t hash = mix(key);
+    const auto control = control_of(hash);
+    const std::size_t mask = controls_.size() - 1UZ;
+    for (std::size_t position = hash & mask;; position = (position + 1UZ) & mask) {
+      if (controls_[position] == control && key_of(slots_[position]) == key) {
+        return position;
+      }
+      if (controls_[position] == std::uint8_t{}) {
+        return none;
+      }
+    }
+  }
+
+  // Position of the key, inserted with `make_slot()` unless already there, and whether it was
+  template <typename MakeSlot>
+  auto insert_position(const std::uint64_t key, const MakeSlot& make_slot)
+      -> std::pair<std::size_t, bool> {
+    reserve(size_ + 1UZ);
+    const std::uint64_t hash = mix(key);
+    const auto control = control_of(hash);
+    const std::size_t mask = controls_.size() - 1UZ;
+    for (std::size_t position = hash & mask;; position = (position + 1UZ) & mask) {
+      if (controls_[position] == control && key_of(slots_[position]) == key) {
+        return {position, false};
+      }
+      if (controls_[position] == std::uint8_t{}) {
+        controls_[position] = control;
+        slots_[position] = make_slot();
+        ++size_;
+        return {position, true};
+      }
+    }
+  }
+
+  // Iterator over the occupied positions, which `Derived::value_at` turns into values
+  template <typename Table>
+  class Iterator {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = decltype(std::declval<const Table&>().value_at(0UZ));
+
+    Iterator() = default;
+    Iterator(const Table* const table, const std::size_t position)
+        : table_(table), position_(position) {
+      skip_empty();
+    }
+
+    auto operator*() const -> value_type { return table_->value_at(position_); }
+
+    auto operator++() -> Iterator& {
+      ++position_;
+      skip_empty();
+      return *this;
+    }
+
+    auto operator++(int) -> Iterator {
+      auto result = *this;
+      ++*this;
+      return result;
+    }
+
+    auto operator==(const Iterator& other) const -> bool { return position_ == other.position_; }
+
+   private:
+    void skip_empty() {
+      while (position_ < table_->controls_.size() &&
+             table_->controls_[position_] == std::uint8_t{}) {
+        ++position_;
+      }
+    }
+
+    const Table* table_{};
+    std::size_t position_{};
+  };
+
+  auto slot(const std::size_t position) -> Slot& { return slots_[position]; }
+  auto slot(const std::size_t position) const -> const Slot& { return slots_[position]; }
+  auto capacity() const -> std::size_t { return controls_.size(); }
+
+  static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+ private:
+  static constexpr std::size_t min_capacity = 8UZ;
+
+  // The tables are kept at most 3/4 full
+  static auto max_size(const std::size_t capacity) -> std::size_t {
+    return capacity - (capacity / 4UZ);
+  }
+
+  // splitmix64 finalizer, as packed coordinates differ mostly in their low bits
+  static auto mix(std::uint64_t key) -> std::uint64_t {
+    key = (key ^ (key >> 30U)) * 0xBF58476D1CE4E5B9U;
+    key = (key ^ (key >> 27U)) * 0x94D049BB133111EBU;
+    return key ^ (key >> 31U);
+  }
+
+  static auto control_of(const std::uint64_t hash) -> std::uint8_t {
+    return std::uint8_t(0x80U | (hash >> 57U));
+  }
+
+  void rehash(const std::size_t capacity) {
+    auto controls = std::exchange(
+        controls_, std::pmr::vector<std::uint8_t>(capacity, controls_.get_allocator()));
+    auto slots = std::exchange(slots_, std::pmr::vector<Slot>(capacity, slots_.get_allocator()));
+    const std::size_t mask = capacity - 1UZ;
+    for (std::size_t old_position = 0UZ; old_position < controls.size(); ++old_position) {
+      if (controls[old_position] == std::uint8_t{}) {
+        continue;
+      }
+      std::size_t position = mix(key_of(slots[old_position])) & mask;
+      while (controls_[position] != std::uint8_t{}) {
+        position = (position + 1UZ) & mask;
+      }
+      controls_[position] = controls[old_position];
+      slots_[position] = std::move(slots[old_position]);
+    }
+  }
+
+  std::pmr::vector<std::uint8_t> controls_;
+  std::pmr::vector<Slot> slots_;
+  std::size_t size_{};
+};
+
+}  // namespace coords_detail
+
+// Hash set of locations whose coordinates fit into 64 bits once packed, see `pack_coords`, which
+// throws on inserting any other one. Iterating over the locations visits them in no particular
+// order.
+template <typename Loc>
+class CoordSet : public coords_detail::PackedTable<std::uint64_t> {
+  using Base = coords_detail::PackedTable<std::uint64_t>;
+
+ public:
+  using iterator = Base::Iterator<CoordSet>;
+  using const_iterator = iterator;
+
+  explicit CoordSet(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+      : Base(resource) {}
+
+  CoordSet(const std::initializer_list<Loc> locs,
+           std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+      : Base(resource) {
+    for (const Loc& loc : locs) {
+      insert(loc);
+    }
+  }
+
+  auto contains(const Loc& loc) const -> bool {
+    return fits_packed(loc) && find_position(pack_coords(loc)) != none;
+  }
+
+  // Whether the location was not in the set yet
+  auto insert(const Loc& loc) -> bool {
+    const std::uint64_t key = checked_pack_coords(loc);
+    return insert_position(key, [key]() { return key; }).second;
+  }
+
+  // Moves the locations of `other` into this set
+  void merge(CoordSet&& other) {
+    reserve(size() + other.size());
+    for (const Loc& loc : other) {
+      insert(loc);
+    }
+    other.clear();
+  }
+
+  auto begin() const -> iterator { return {this, 0UZ}; }
+  auto end() const -> iterator { return {this, capacity()}; }
+
+ private:
+  friend iterator;
+
+  auto value_at(const std::size_t position) const -> Loc {
+    return unpack_coords<Loc>(slot(position));
+  }
+};
+
+// Hash map keyed by locations whose coordinates fit into 64 bits once packed, see `pack_coords`,
+// which throws on inserting any other one. Iterating over the entries visits them in no particular
+// order.
+template <typename Loc, typename T>
+class CoordMap : public coords_detail::PackedTable<std::pair<std::uint64_t, T>> {
+  using Base = coords_detail::PackedTable<std::pair<std::uint64_t, T>>;
+  using Base::none;
+
+ public:
+  using iterator = Base::template Iterator<CoordMap>;
+  using const_iterator = iterator;
+
+  explicit CoordMap(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+      : Base(resource) {}
+
+  auto contains(const Loc& loc) const -> bool { return position_of(loc) != none; }
+
+  // Value of the location, or nullptr
+  auto find(const Loc& loc) -> T* {
+    const std::size_t position = position_of(loc);
+    return position == none ? nullptr : &this->slot(position).second;
+  }
+
+  auto find(const Loc& loc) const -> const T* {
+    const std::size_t position = position_of(loc);
+    return position == none ? nullptr : &this->slot(position).second;
+  }
+
+  // Value of the location, inserted as `value` unless already there, and whether it was
+  auto try_emplace(const Loc& loc, T value = {}) -> std::pair<T&, bool> {
+    const std::uint64_t key = checked_pack_coords(loc);
+    const auto [position, inserted] =
+        this->insert_position(key, [&]() { return std::pair{key, std::move(value)}; });
+    return {this->slot(position).second, inserted};
+  }
+
+  auto operator[](const Loc& loc) -> T& { return try_emplace(loc).first; }
+
+  auto begin() const -> iterator { return {this, 0UZ}; }
+  auto end() const -> iterator { return {this, this->capacity()}; }
+
+ private:
+  friend iterator;
+
+  auto position_of(const Loc& loc) const -> std::size_t {
+    return fits_packed(loc) ? this->find_position(pack_coords(loc)) : none;
+  }
+
+  auto value_at(const std::size_t position) const -> std::pair<Loc, const T&> {
+    const auto& [key, value] = this->slot(position);
+    return {unpack_coords<Loc>(key), value};
+  }
+};
+
+}  // namespace common
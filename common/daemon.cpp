@@ -0,0 +1,339 @@
+#include <pthread.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/quest.hpp"
+#include "common/resident.hpp"
+#include "common/result_cache.hpp"
+#include "common/socket.hpp"
+#include "common/text.hpp"
+#include "common/thread_pool.hpp"
+
+namespace {
+
+struct Options {
+  std::size_t thread_count{std::max(1U, std::thread::hardware_concurrency())};
+  std::filesystem::path socket{"solver.sock"};
+  std::optional<std::filesystem::path> cache_directory;
+  std::size_t resident_capacity{64UZ};
+  std::size_t max_request_bytes{std::size_t{256} << 20U};
+};
+
+constexpr std::string_view usage =
+    "Usage: daemon [--threads N] [--socket PATH] [--resident N] [--cache]\n"
+    "              [--cache-directory DIR] [--max-request-bytes N]\n"
+    "\n"
+    "Solves the parts requested by the clients of the Unix domain socket PATH, serving up to N\n"
+    "connections concurrently, and keeps the N most recently used precomputations of the\n"
+    "solvers (64 by default) in memory.\n"
+    "A request is a line \"QUEST PART SIZE...\" followed by the contents of the input files of\n"
+    "the part, of the given sizes, and is answered by a line \"OK ANSWER\" or \"ERROR MESSAGE\".\n"
+    "Requests of more than N bytes of input files (256 MiB by default) are refused unread.\n"
+    "With --cache, answers are looked up in, and saved to, DIR, as by the quest executables.\n"
+    "The request \"STATS\" is answered by \"OK HITS MISSES RESIDENT_HITS RESIDENT_MISSES\" for\n"
+    "the answers and the precomputations.";
+
+auto parse_count(const std::string_view text) -> std::optional<std::size_t> {
+  std::size_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  Options result;
+
+  for (auto arg_it = args.begin(); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    const auto value = [&]() -> std::optional<std::string_view> {
+      if (std::next(arg_it) == args.end()) {
+        return {};
+      }
+      return *++arg_it;
+    };
+
+    if (arg == "--threads") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.thread_count = *count;
+    } else if (arg == "--socket") {
+      const auto path = value();
+      if (!path) {
+        return {};
+      }
+      result.socket = *path;
+    } else if (arg == "--resident") {
+      const auto count = value().and_then(parse_count);
+      if (!count) {
+        return {};
+      }
+      result.resident_capacity = *count;
+    } else if (arg == "--cache") {
+      const auto directory = common::ResultCache::default_directory();
+      if (!directory) {
+        return {};
+      }
+      result.cache_directory = result.cache_directory.value_or(*directory);
+    } else if (arg == "--cache-directory") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.cache_directory = *directory;
+    } else if (arg == "--max-request-bytes") {
+      const auto count = value().and_then(parse_count);
+      if (!count) {
+        return {};
+      }
+      result.max_request_bytes = *count;
+    } else {
+      return {};
+    }
+  }
+
+  return result;
+}
+
+// Answer of the part, from the cache when given and holding it. The precomputations that the
+// solvers keep resident are shared by all the requests.
+auto solve(const common::Quest& quest, const std::size_t part_number,
+           const std::span<const std::string> contents, common::ResultCache* const cache)
+    -> std::string {
+  const auto sources = contents | std::ranges::to<std::vector<std::string_view>>();
+  std::uint64_t key{};
+  if (cache != nullptr) {
+    key = cache->key(quest.name, part_number, sources);
+    if (auto answer = cache->find(key)) {
+      return std::format("OK {}\n", *answer);
+    }
+  }
+
+  const auto& part = quest.parts[part_number - 1UZ];
+  std::string answer;
+  try {
+    const auto input = part.parse(sources);
+    answer = part.solve(input);
+  } catch (const std::exception& exception) {
+    return std::format("ERROR {}\n", exception.what());
+  }
+  if (cache != nullptr) {
+    cache->store(key, answer);
+  }
+  return std::format("OK {}\n", answer);
+}
+
+struct Response {
+  std::string line;
+  bool keeps_connection;
+};
+
+auto respond(const std::string_view header, common::Connection& connection,
+             const Options& options, common::ResultCache* const cache) -> Response {
+  const auto words = common::words(header) | std::ranges::to<std::vector>();
+  if (words.size() == 1UZ && words.front() == "STATS") {
+    const auto [resident_hits, resident_misses] = common::resident_store().statistics();
+    return {.line = std::format("OK {} {} {} {}\n", cache != nullptr ? cache->hits() : 0UZ,
+                                cache != nullptr ? cache->misses() : 0UZ, resident_hits,
+                                resident_misses),
+            .keeps_connection = true};
+  }
+
+  // The sizes must be valid to find the next request, whereas other errors are recoverable
+  const auto sizes = words | std::views::drop(2) | std::views::transform(parse_count) |
+                     std::ranges::to<std::vector>();
+  if (words.size() < 3UZ ||
+      std::ranges::any_of(sizes, [](const auto& size) { return !size.has_value(); })) {
+    return {.line = "ERROR malformed request\n", .keeps_connection = false};
+  }
+  // Summed without overflowing, as the sizes are announced by the client
+  std::size_t remaining_bytes = options.max_request_bytes;
+  for (const auto& size : sizes) {
+    if (*size > remaining_bytes) {
+      return {.line = "ERROR request too large\n", .keeps_connection = false};
+    }
+    remaining_bytes -= *size;
+  }
+  std::vector<std::string> contents;
+  for (const auto& size : sizes) {
+    auto content = connection.read_exact(*size);
+    if (!content) {
+      return {.line = {}, .keeps_connection = false};
+    }
+    contents.push_back(*std::move(content));
+  }
+
+  const auto& quests = common::registry();
+  const auto quest = std::ranges::find(quests, words[0], &common::Quest::name);
+  if (quest == quests.end()) {
+    return {.line = std::format("ERROR unknown quest {}\n", words[0]), .keeps_connection = true};
+  }
+  const auto part_number = parse_count(words[1]);
+  if (!part_number || *part_number == 0UZ || *part_number > quest->parts.size()) {
+    return {.line = std::format("ERROR unknown part {}\n", words[1]), .keeps_connection = true};
+  }
+  const std::size_t file_count = quest->parts[*part_number - 1UZ].files.size();
+  if (contents.size() != file_count) {
+    return {.line = std::format("ERROR expected {} input files\n", file_count),
+            .keeps_connection = true};
+  }
+
+  return {.line = solve(*quest, *part_number, contents, cache), .keeps_connection = true};
+}
+
+// Sockets of the connections being served, shut down when the daemon stops
+class Connections {
+ public:
+  void add(const int fd) {
+    const std::scoped_lock lock{mutex_};
+    fds_.insert(fd);
+  }
+
+  void remove(const int fd) {
+    const std::scoped_lock lock{mutex_};
+    fds_.erase(fd);
+  }
+
+  void shut_down() {
+    const std::scoped_lock lock{mutex_};
+    for (const int fd : fds_) {
+      ::shutdown(fd, SHUT_RDWR);
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_set<int> fds_;
+};
+
+// Unregisters a connection however its serving ends, before its socket is closed, so that
+// `Connections` never holds the number of a socket that may have been reused since
+class Registration {
+ public:
+  Registration(Connections& connections, const int fd) : connections_(connections), fd_(fd) {}
+
+  Registration(const Registration&) = delete;
+  auto operator=(const Registration&) -> Registration& = delete;
+  Registration(Registration&&) = delete;
+  auto operator=(Registration&&) -> Registration& = delete;
+
+  ~Registration() { connections_.remove(fd_); }
+
+ private:
+  Connections& connections_;
+  int fd_;
+};
+
+// The connection is registered before being served. The errors that escape a request, such as
+// running out of memory or failing to store an answer, close the connection, as the tasks of the
+// pool would silently drop them.
+void serve(const int fd, const Options& options, common::ResultCache* const cache,
+           Connections& connections) {
+  common::Connection connection{fd};
+  const Registration registration{connections, fd};
+  try {
+    while (const auto header = connection.read_line()) {
+      const auto [line, keeps_connection] = respond(*header, connection, options, cache);
+      if (!connection.write_all(line) || !keeps_connection) {
+        break;
+      }
+    }
+  } catch (const std::exception& exception) {
+    std::println(stderr, "Connection closed: {}", exception.what());
+  }
+}
+
+std::atomic<bool> stopping;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    return EXIT_FAILURE;
+  }
+
+  const auto address = common::Connection::socket_address(options->socket);
+  const common::Connection listener{::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+  std::error_code error;
+  std::filesystem::remove(options->socket, error);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (!address || !listener ||
+      ::bind(listener.fd(), reinterpret_cast<const sockaddr*>(&*address), sizeof(*address)) != 0 ||
+      ::listen(listener.fd(), SOMAXCONN) != 0) {
+    std::println(stderr, "Cannot listen on {}", options->socket.string());
+    return EXIT_FAILURE;
+  }
+
+  // Interrupting the daemon stops accepting connections and closes the ones being served.
+  // The signals are delivered to the main thread only, so that they interrupt the accept call.
+  struct sigaction action{};
+  action.sa_handler = [](int /*signal*/) { stopping = true; };
+  ::sigaction(SIGINT, &action, nullptr);
+  ::sigaction(SIGTERM, &action, nullptr);
+  sigset_t signals{};
+  ::sigemptyset(&signals);
+  ::sigaddset(&signals, SIGINT);
+  ::sigaddset(&signals, SIGTERM);
+
+  common::resident_store().set_capacity(options->resident_capacity);
+  std::optional<common::ResultCache> cache;
+  if (options->cache_directory) {
+    cache.emplace(*options->cache_directory);
+  }
+  common::ResultCache* const cache_pointer = cache ? &*cache : nullptr;
+  Connections connections;
+  {
+    ::pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    common::ThreadPool pool{options->thread_count};
+    ::pthread_sigmask(SIG_UNBLOCK, &signals, nullptr);
+    while (!stopping) {
+      const int fd = ::accept4(listener.fd(), nullptr, nullptr, SOCK_CLOEXEC);
+      if (fd < 0) {
+        if (errno != EINTR) {
+          std::println(stderr, "Cannot accept connections");
+          break;
+        }
+        continue;
+      }
+      connections.add(fd);
+      pool.submit([fd, &options, cache_pointer, &connections]() {
+        serve(fd, *options, cache_pointer, connections);
+      });
+    }
+    connections.shut_down();
+  }
+  std::filesystem::remove(options->socket, error);
+
+  return EXIT_SUCCESS;
+}
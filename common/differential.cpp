@@ -0,0 +1,264 @@
+#include <algorithm>
+#include <any>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "common/external_bfs.hpp"
+#include "common/quest.hpp"
+#include "gen/generators.hpp"
+
+namespace {
+
+struct Options {
+  std::uint64_t seed{1U};
+  std::size_t repetition_count{3UZ};
+  std::chrono::milliseconds budget{1'000};
+  std::optional<std::size_t> max_size;
+  // Settings of the searches compared to the ones in memory, if any
+  std::optional<common::ExternalMemorySettings> external_memory;
+  std::vector<std::string> quests;
+};
+
+constexpr std::string_view usage =
+    "Usage: differential [--seed N] [--repetitions N] [--budget MS] [--max-size N]\n"
+    "                    [--external-memory DIR [--memory-budget-bytes N]] [QUEST...]\n"
+    "\n"
+    "Solves the parts of the given quests, or of all of them, that keep a reference solving, and\n"
+    "their variants, with both engines on synthetic inputs of doubling sizes, until an engine\n"
+    "takes more than MS milliseconds or the size exceeds N, which defaults to the default size of\n"
+    "the generator. Reports the best times of the engines and their ratio, and fails as soon as\n"
+    "their answers differ.\n"
+    "\n"
+    "With --external-memory, every part is solved instead with its searches in memory as the\n"
+    "reference, and in external memory in DIR, sorting in N bytes (64 MiB by default), which can\n"
+    "be made small enough to spill runs on the smallest maps.";
+
+// The smallest size is the default size of the generator divided by 2 to this power
+constexpr std::size_t size_doubling_count = 12UZ;
+
+auto parse_count(const std::string_view text) -> std::optional<std::size_t> {
+  std::size_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  Options result;
+
+  for (auto arg_it = args.begin(); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    const auto value = [&]() -> std::optional<std::string_view> {
+      if (std::next(arg_it) == args.end()) {
+        return {};
+      }
+      return *++arg_it;
+    };
+
+    if (arg == "--seed") {
+      const auto seed = value().and_then(parse_count);
+      if (!seed) {
+        return {};
+      }
+      result.seed = *seed;
+    } else if (arg == "--repetitions") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.repetition_count = *count;
+    } else if (arg == "--budget") {
+      const auto milliseconds = value().and_then(parse_count);
+      if (!milliseconds) {
+        return {};
+      }
+      result.budget = std::chrono::milliseconds(*milliseconds);
+    } else if (arg == "--max-size") {
+      const auto size = value().and_then(parse_count);
+      if (!size || *size == 0UZ) {
+        return {};
+      }
+      result.max_size = *size;
+    } else if (arg == "--external-memory") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.external_memory = result.external_memory.value_or(common::ExternalMemorySettings{});
+      result.external_memory->directory = *directory;
+    } else if (arg == "--memory-budget-bytes") {
+      const auto bytes = value().and_then(parse_count);
+      if (!bytes || *bytes == 0UZ) {
+        return {};
+      }
+      result.external_memory = result.external_memory.value_or(common::ExternalMemorySettings{});
+      result.external_memory->memory_budget = *bytes;
+    } else if (arg.starts_with("--")) {
+      return {};
+    } else {
+      result.quests.emplace_back(arg);
+    }
+  }
+
+  return result;
+}
+
+using Solve = std::function<std::string(const std::any&)>;
+
+struct Run {
+  std::string answer;
+  std::chrono::nanoseconds duration;
+};
+
+// Answer of the last run, and the shortest duration of them
+auto best_run(const Solve& solve, const std::any& input, const std::size_t repetition_count)
+    -> Run {
+  using Clock = std::chrono::steady_clock;
+  Run result{.answer = {}, .duration = std::chrono::nanoseconds::max()};
+  for (std::size_t i = 0UZ; i < repetition_count; ++i) {
+    const auto start = Clock::now();
+    result.answer = solve(input);
+    result.duration = std::min(result.duration, Clock::now() - start);
+  }
+  return result;
+}
+
+auto to_micros(const std::chrono::nanoseconds duration) -> double {
+  return std::chrono::duration<double, std::micro>{duration}.count();
+}
+
+// Whether both engines agree on every size
+auto check(const common::Quest& quest, const std::size_t quest_number,
+           const std::size_t part_number, const Options& options) -> bool {
+  const auto& part = quest.parts[part_number - 1UZ];
+  const auto& generator = gen::generators[quest_number - 1UZ];
+  const std::size_t max_size = options.max_size.value_or(generator.default_size);
+
+  for (std::size_t size = std::max(1UZ, generator.default_size >> size_doubling_count);
+       size <= max_size; size *= 2UZ) {
+    const auto files = gen::generate(quest_number, part_number, options.seed, size);
+    std::vector<std::string_view> sources;
+    for (const auto& name : part.files) {
+      const auto file = std::ranges::find(files, name, &gen::File::name);
+      if (file == files.end()) {
+        std::println(stderr, "{} part #{}: no generated file {}", quest.name, part_number, name);
+        return false;
+      }
+      sources.emplace_back(file->contents);
+    }
+
+    // Whether the engines agree, and whether one of them took more than the budget
+    bool over_budget{};
+    const auto compare = [&](const std::string_view label, const Run& reference,
+                             const Run& optimized) {
+      if (reference.answer != optimized.answer) {
+        std::println(stderr,
+                     "{} part #{}{} size {} seed {}: reference answer {}, optimized answer {}",
+                     quest.name, part_number, label, size, options.seed, reference.answer,
+                     optimized.answer);
+        return false;
+      }
+
+      const double reference_micros = to_micros(reference.duration);
+      const double optimized_micros = to_micros(optimized.duration);
+      std::println(
+          "{} part #{}{} size {:>9}: reference {:>12.1f} us, optimized {:>12.1f} us, speedup "
+          "{:.2f}",
+          quest.name, part_number, label, size, reference_micros, optimized_micros,
+          reference_micros / std::max(optimized_micros, 1e-3));
+      over_budget =
+          over_budget || std::max(reference.duration, optimized.duration) > options.budget;
+      return true;
+    };
+
+    if (options.external_memory) {
+      // The parsers choose the searches from the settings, which the external ones also read
+      auto& settings = common::external_memory_settings();
+      settings = {};
+      const auto in_memory = best_run(part.solve, part.parse(sources), options.repetition_count);
+      settings = *options.external_memory;
+      const auto external = best_run(part.solve, part.parse(sources), options.repetition_count);
+      settings = {};
+      if (!compare(" (external memory)", in_memory, external)) {
+        return false;
+      }
+    } else {
+      const auto input = part.parse(sources);
+      const auto compare_engines = [&](const std::string_view label, const Solve& solve,
+                                       const Solve& reference) {
+        const auto reference_run = best_run(reference, input, options.repetition_count);
+        return compare(label, reference_run, best_run(solve, input, options.repetition_count));
+      };
+      if (part.reference && !compare_engines("", part.solve, part.reference)) {
+        return false;
+      }
+      for (const auto& variant : part.variants) {
+        if (!compare_engines(std::format(" ({})", variant.name), variant.solve,
+                             variant.reference)) {
+          return false;
+        }
+      }
+    }
+    if (over_budget) {
+      break;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    return EXIT_FAILURE;
+  }
+
+  const auto& quests = common::registry();
+  for (const auto& name : options->quests) {
+    if (!std::ranges::contains(quests, name, &common::Quest::name)) {
+      std::println(stderr, "Unknown quest {}", name);
+      return EXIT_FAILURE;
+    }
+  }
+
+  for (const auto& quest : quests) {
+    if (!options->quests.empty() && !std::ranges::contains(options->quests, quest.name)) {
+      continue;
+    }
+    // Quests are named questNN after their number
+    const auto quest_number = parse_count(std::string_view{quest.name}.substr(5UZ));
+    if (!quest_number || *quest_number == 0UZ || *quest_number > gen::generators.size()) {
+      continue;
+    }
+    for (const std::size_t part_number : std::views::iota(1UZ, quest.parts.size() + 1UZ)) {
+      const auto& part = quest.parts[part_number - 1UZ];
+      if (!options->external_memory && !part.reference && part.variants.empty()) {
+        continue;
+      }
+      if (!check(quest, *quest_number, part_number, *options)) {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,386 @@
+#pragma once
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/grid.hpp"
+
+namespace common {
+
+struct ExternalMemorySettings {
+  // Directory of the temporary files of the searches, none keeping the searches in memory
+  std::optional<std::filesystem::path> directory;
+  // Memory of the sorts of the searches, in bytes
+  std::size_t memory_budget{std::size_t{64} << 20U};
+};
+
+// Settings of the external-memory searches of the current process, set by the drivers before
+// parsing, as the parsers of the quests that support them keep the raw text of the map instead
+inline auto external_memory_settings() -> ExternalMemorySettings& {
+  static ExternalMemorySettings settings;
+  return settings;
+}
+
+// Grid of characters in the lines of a text, which must all be of the same length, such as the
+// contents of a mapped input file. Tiles are addressed by the linear index
+// row * (col_count + 1) + col, so that the line feeds act as the walls of the side borders, and
+// the indices beyond the text as those of the top and bottom borders.
+class TextGrid {
+ public:
+  using Index = std::size_t;
+  using Offset = std::ptrdiff_t;
+
+  static constexpr char outside = '\n';
+
+  explicit TextGrid(const std::string_view text)
+      : text_(text),
+        col_count_(Coord(std::min(text.find('\n'), text.size()))),
+        stride_(std::size_t(col_count_) + 1UZ),
+        row_count_(Coord((text.size() + 1UZ) / stride_)) {}
+
+  auto row_count() const { return row_count_; }
+  auto col_count() const { return col_count_; }
+
+  auto index(const Loc& loc) const -> Index {
+    return (std::size_t(loc[0]) * stride_) + std::size_t(loc[1]);
+  }
+
+  auto loc(const Index index) const -> Loc {
+    return {Coord(index / stride_), Coord(index % stride_)};
+  }
+
+  template <std::size_t n>
+  auto offsets(const std::array<Loc, n>& moves) const -> std::array<Offset, n> {
+    std::array<Offset, n> result{};
+    std::ranges::transform(moves, result.begin(), [this](const Loc& move) {
+      return (Offset(move[0]) * Offset(stride_)) + Offset(move[1]);
+    });
+    return result;
+  }
+
+  // Tile at the index, which may be any neighbour of a tile of the grid
+  auto operator[](const Index index) const -> char {
+    return index < text_.size() ? text_[index] : outside;
+  }
+
+  auto text() const -> std::string_view { return text_; }
+
+ private:
+  std::string_view text_;
+  Coord col_count_;
+  std::size_t stride_;
+  Coord row_count_;
+};
+
+// Values written sequentially to an anonymous temporary file, then read back in the same order,
+// as many times as needed. Failures of the file system are thrown as `std::system_error`.
+template <typename T>
+class Run {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+ public:
+  explicit Run(const std::filesystem::path& directory) {
+    auto pattern = (directory / "run-XXXXXX").string();
+    fd_ = ::mkstemp(pattern.data());
+    if (fd_ < 0) {
+      throw std::system_error{errno, std::generic_category(), pattern};
+    }
+    ::unlink(pattern.c_str());
+  }
+
+  Run(const Run&) = delete;
+  auto operator=(const Run&) -> Run& = delete;
+
+  Run(Run&& other) noexcept
+      : fd_(std::exchange(other.fd_, -1)),
+        buffer_(std::move(other.buffer_)),
+        position_(other.position_),
+        size_(other.size_),
+        reading_(other.reading_) {}
+
+  auto operator=(Run&& other) noexcept -> Run& {
+    std::swap(fd_, other.fd_);
+    std::swap(buffer_, other.buffer_);
+    std::swap(position_, other.position_);
+    std::swap(size_, other.size_);
+    std::swap(reading_, other.reading_);
+    return *this;
+  }
+
+  ~Run() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  auto size() const -> std::size_t { return size_; }
+
+  // Appends a value, before the first `rewind()`
+  void push(const T& value) {
+    buffer_.push_back(value);
+    ++size_;
+    if (buffer_.size() == buffer_capacity) {
+      flush();
+    }
+  }
+
+  // Empties the run, which can be written again
+  void clear() {
+    if (::ftruncate(fd_, 0) != 0 || ::lseek(fd_, 0, SEEK_SET) < 0) {
+      throw std::system_error{errno, std::generic_category(), "ftruncate"};
+    }
+    buffer_.clear();
+    position_ = 0UZ;
+    size_ = 0UZ;
+    reading_ = false;
+  }
+
+  // Restarts reading from the first value
+  void rewind() {
+    if (!reading_) {
+      flush();
+      reading_ = true;
+    }
+    if (::lseek(fd_, 0, SEEK_SET) < 0) {
+      throw std::system_error{errno, std::generic_category(), "lseek"};
+    }
+    buffer_.clear();
+    position_ = 0UZ;
+  }
+
+  // Next value, after a `rewind()`
+  auto next() -> std::optional<T> {
+    if (position_ == buffer_.size()) {
+      const std::size_t capacity = std::min(buffer_capacity, size_);
+      buffer_.resize(capacity);
+      const std::size_t byte_count = read_bytes(buffer_.data(), capacity * sizeof(T));
+      buffer_.resize(byte_count / sizeof(T));
+      position_ = 0UZ;
+      if (buffer_.empty()) {
+        return {};
+      }
+    }
+    return buffer_[position_++];
+  }
+
+ private:
+  static constexpr std::size_t buffer_capacity = (std::size_t{1} << 20U) / sizeof(T);
+
+  void flush() {
+    const auto* data = reinterpret_cast<const char*>(buffer_.data());  // NOLINT
+    std::size_t remaining = buffer_.size() * sizeof(T);
+    while (remaining != 0UZ) {
+      const auto written = ::write(fd_, data, remaining);
+      if (written < 0 && errno != EINTR) {
+        throw std::system_error{errno, std::generic_category(), "write"};
+      }
+      if (written > 0) {
+        data += written;
+        remaining -= std::size_t(written);
+      }
+    }
+    buffer_.clear();
+  }
+
+  auto read_bytes(T* const values, const std::size_t capacity) -> std::size_t {
+    auto* data = reinterpret_cast<char*>(values);  // NOLINT
+    std::size_t result{};
+    while (result < capacity) {
+      const auto count = ::read(fd_, data + result, capacity - result);
+      if (count < 0 && errno != EINTR) {
+        throw std::system_error{errno, std::generic_category(), "read"};
+      }
+      if (count == 0) {
+        break;
+      }
+      if (count > 0) {
+        result += std::size_t(count);
+      }
+    }
+    return result;
+  }
+
+  int fd_{-1};
+  std::vector<T> buffer_;
+  std::size_t position_{};
+  std::size_t size_{};
+  bool reading_{};
+};
+
+// Sort with duplicate elimination of more values than the memory holds: the values are sorted in
+// memory by batches of `capacity`, which are spilled as sorted runs and merged at the end. Values
+// that fit in a single batch never reach the disk.
+template <typename T>
+class RunSorter {
+ public:
+  RunSorter(std::filesystem::path directory, const std::size_t capacity)
+      : directory_(std::move(directory)), capacity_(std::max(capacity, 1UZ)) {}
+
+  void push(const T& value) {
+    buffer_.push_back(value);
+    if (buffer_.size() == capacity_) {
+      spill();
+    }
+  }
+
+  // Calls `visit(value)` for every distinct value pushed, in increasing order, and starts over
+  template <typename Visit>
+  void merge(const Visit& visit) {
+    if (runs_.empty()) {
+      sort_buffer();
+      std::ranges::for_each(buffer_, visit);
+      buffer_.clear();
+      return;
+    }
+    if (!buffer_.empty()) {
+      spill();
+    }
+
+    using Head = std::pair<T, std::size_t>;
+    std::priority_queue<Head, std::vector<Head>, std::greater<>> heads;
+    for (std::size_t rank = 0UZ; rank < runs_.size(); ++rank) {
+      runs_[rank].rewind();
+      if (const auto value = runs_[rank].next()) {
+        heads.emplace(*value, rank);
+      }
+    }
+    std::optional<T> last;
+    while (!heads.empty()) {
+      const auto [value, rank] = heads.top();
+      heads.pop();
+      if (last != value) {
+        visit(value);
+        last = value;
+      }
+      if (const auto next = runs_[rank].next()) {
+        heads.emplace(*next, rank);
+      }
+    }
+    runs_.clear();
+  }
+
+ private:
+  void sort_buffer() {
+    std::ranges::sort(buffer_);
+    const auto duplicates = std::ranges::unique(buffer_);
+    buffer_.erase(duplicates.begin(), duplicates.end());
+  }
+
+  void spill() {
+    sort_buffer();
+    auto& run = runs_.emplace_back(directory_);
+    for (const T& value : buffer_) {
+      run.push(value);
+    }
+    buffer_.clear();
+  }
+
+  std::filesystem::path directory_;
+  std::size_t capacity_;
+  std::vector<T> buffer_;
+  std::vector<Run<T>> runs_;
+};
+
+namespace external_detail {
+
+// Sorted run read one value ahead, for merges
+template <typename T>
+class Cursor {
+ public:
+  explicit Cursor(Run<T>& run) : run_(run) {
+    run_.rewind();
+    head_ = run_.next();
+  }
+
+  // Whether the run holds `value`, skipping the smaller values, which must be visited in
+  // increasing order
+  auto holds(const T& value) -> bool {
+    while (head_ && *head_ < value) {
+      head_ = run_.next();
+    }
+    return head_ == value;
+  }
+
+ private:
+  Run<T>& run_;
+  std::optional<T> head_;
+};
+
+}  // namespace external_detail
+
+// Breadth-first search over the tiles of `grid` such that `is_open(tile)`, from the `sources`,
+// calling `visit(index, distance)` for every tile reached, layer after layer, until `done()` after
+// a layer or until no tile is left. The temporary files and the memory budget are taken from
+// `external_memory_settings()`.
+//
+// Following Munagala and Ranade, only the last two layers are kept, as sorted runs on disk. The
+// neighbours of the last layer are sorted externally without duplicates, and the next layer is
+// what remains of them once the tiles of the last two layers are removed, which takes a single
+// sequential pass over the three of them, as the neighbours of a tile are at most one layer away.
+template <std::size_t n, typename IsOpen, typename Visit, typename Done>
+void external_bfs(const TextGrid& grid, const std::array<Loc, n>& moves,
+                  std::vector<TextGrid::Index> sources, const IsOpen& is_open, const Visit& visit,
+                  const Done& done) {
+  using Index = TextGrid::Index;
+
+  const auto& settings = external_memory_settings();
+  const auto& directory = settings.directory.value();
+  const std::size_t capacity = settings.memory_budget / sizeof(Index);
+  const auto offsets = grid.offsets(moves);
+
+  std::ranges::sort(sources);
+  const auto duplicates = std::ranges::unique(sources);
+  sources.erase(duplicates.begin(), duplicates.end());
+
+  // The runs are recycled from layer to layer
+  Run<Index> previous{directory};
+  Run<Index> current{directory};
+  Run<Index> next{directory};
+  for (const Index index : sources) {
+    current.push(index);
+    visit(index, 0UZ);
+  }
+
+  RunSorter<Index> neighbours{directory, capacity};
+  for (std::size_t distance = 1UZ; current.size() != 0UZ && !done(); ++distance) {
+    current.rewind();
+    while (const auto index = current.next()) {
+      for (const TextGrid::Offset offset : offsets) {
+        const Index candidate = *index + Index(offset);
+        if (is_open(grid[candidate])) {
+          neighbours.push(candidate);
+        }
+      }
+    }
+
+    next.clear();
+    external_detail::Cursor<Index> previous_cursor{previous};
+    external_detail::Cursor<Index> current_cursor{current};
+    neighbours.merge([&](const Index candidate) {
+      if (!previous_cursor.holds(candidate) && !current_cursor.holds(candidate)) {
+        next.push(candidate);
+        visit(candidate, distance);
+      }
+    });
+
+    std::swap(previous, current);
+    std::swap(current, next);
+  }
+}
+
+}  // namespace common
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "common/line_chunks.hpp"
+
+namespace common {
+
+using Coord = std::int32_t;
+using Loc = std::array<Coord, 2>;  // {row, column}
+
+// Dense row-major grid surrounded by a one-tile sentinel border.
+//
+// Interior tiles are addressed either by location or by linear index. Because of the border, the
+// linear index of any neighbour (including diagonal ones) of an interior tile is valid, so that
+// search loops can probe neighbours through precomputed offsets without bounds checks.
+template <typename T>
+class Grid {
+  static_assert(!std::is_same_v<T, bool>, "std::vector<bool> does not hand out references");
+
+ public:
+  using Index = std::size_t;
+  using Offset = std::ptrdiff_t;
+
+  Grid() = default;
+
+  Grid(const Coord row_count, const Coord col_count, const T& value)
+      : row_count_(row_count),
+        col_count_(col_count),
+        stride_(std::size_t(col_count) + 2UZ),
+        tiles_((std::size_t(row_count) + 2UZ) * stride_, value) {}
+
+  // Builds a grid from text rows, mapping every character through `tile(loc, c)`.
+  // Short rows are completed with `value`, which also fills the border.
+  template <std::ranges::forward_range Rows, typename F>
+  static auto from_rows(const Rows& rows, const T& value, F&& tile) -> Grid {
+    const auto row_count = Coord(std::ranges::distance(rows));
+    const auto col_count = Coord(std::ranges::fold_left(
+        std::views::transform(rows, [](const auto& row) { return std::ranges::distance(row); }),
+        std::ptrdiff_t{}, std::ranges::max));
+
+    Grid result{row_count, col_count, value};
+
+    Coord i{};
+    for (const auto& row : rows) {
+      Coord j{};
+      for (const char c : row) {
+        const Loc loc{i, j};
+        result[loc] = tile(loc, c);
+        ++j;
+      }
+      ++i;
+    }
+
+    return result;
+  }
+
+  // Same as `from_rows(lines(text), value, tile)`, with the lines parsed concurrently by chunks,
+  // so that `tile` must be safe to call concurrently
+  template <typename F>
+  static auto from_text(const std::string_view text, const T& value, const F& tile) -> Grid {
+    return from_chunks(split_lines(text), value, tile);
+  }
+
+  // Same as `from_text`, for a text already split, whose chunks can then be parsed again
+  template <typename F>
+  static auto from_chunks(const LineChunks& chunks, const T& value, const F& tile) -> Grid {
+    Grid result{Coord(chunks.row_count), Coord(chunks.max_width), value};
+    parallel_for_lines(chunks, [&](const std::size_t row, const std::string_view line) {
+      const Index first_index = result.index({Coord(row), Coord{}});
+      for (std::size_t col = 0UZ; col < line.size(); ++col) {
+        result.tiles_[first_index + col] = tile(Loc{Coord(row), Coord(col)}, line[col]);
+      }
+    });
+    return result;
+  }
+
+  auto row_count() const { return row_count_; }
+  auto col_count() const { return col_count_; }
+
+  // Number of tiles, border included, i.e. the exclusive upper bound of linear indices
+  auto size() const { return tiles_.size(); }
+
+  auto index(const Loc& loc) const -> Index {
+    return ((std::size_t(loc[0]) + 1UZ) * stride_) + std::size_t(loc[1]) + 1UZ;
+  }
+
+  auto loc(const Index index) const -> Loc {
+    return {Coord(index / stride_) - 1, Coord(index % stride_) - 1};
+  }
+
+  auto offset(const Loc& move) const -> Offset {
+    return (Offset(move[0]) * Offset(stride_)) + Offset(move[1]);
+  }
+
+  template <std::size_t n>
+  auto offsets(const std::array<Loc, n>& moves) const -> std::array<Offset, n> {
+    std::array<Offset, n> result{};
+    std::ranges::transform(moves, result.begin(), [this](const Loc& move) { return offset(move); });
+    return result;
+  }
+
+  auto contains(const Loc& loc) const {
+    return loc[0] >= Coord{} && loc[0] < row_count_ && loc[1] >= Coord{} && loc[1] < col_count_;
+  }
+
+  auto operator[](const Index index) -> T& { return tiles_[index]; }
+  auto operator[](const Index index) const -> const T& { return tiles_[index]; }
+
+  auto operator[](const Loc& loc) -> T& { return tiles_[index(loc)]; }
+  auto operator[](const Loc& loc) const -> const T& { return tiles_[index(loc)]; }
+
+  // Linear indices of the interior tiles, in row-major order
+  auto indices() const {
+    return std::views::iota(Coord{}, row_count_) | std::views::transform([this](const Coord i) {
+             const Index first = index({i, Coord{}});
+             return std::views::iota(first, first + std::size_t(col_count_));
+           }) |
+           std::views::join;
+  }
+
+  // Every tile, border included, in row-major order
+  auto tiles() const -> const std::vector<T>& { return tiles_; }
+
+ private:
+  Coord row_count_{};
+  Coord col_count_{};
+  std::size_t stride_{2UZ};
+  std::vector<T> tiles_;
+};
+
+}  // namespace common
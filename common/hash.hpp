@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace common {
+
+// Fast non-cryptographic 64-bit hash of a byte sequence, which reads it a word at a time
+inline auto hash_bytes(const std::string_view bytes, const std::uint64_t seed = 0U)
+    -> std::uint64_t {
+  constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15U;
+
+  const auto mix = [](std::uint64_t value) {
+    value ^= value >> 32U;
+    value *= 0xD6E8FEB86659FD93U;
+    value ^= value >> 32U;
+    return value;
+  };
+
+  std::uint64_t result = mix(seed ^ (bytes.size() * multiplier));
+  std::size_t position = 0UZ;
+  for (; position + sizeof(std::uint64_t) <= bytes.size(); position += sizeof(std::uint64_t)) {
+    std::uint64_t word{};
+    std::memcpy(&word, bytes.data() + position, sizeof(word));
+    result = mix(result ^ (word * multiplier)) + multiplier;
+  }
+  if (position < bytes.size()) {
+    std::uint64_t word{};
+    std::memcpy(&word, bytes.data() + position, bytes.size() - position);
+    result = mix(result ^ (word * multiplier)) + multiplier;
+  }
+  return mix(result);
+}
+
+}  // namespace common
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/quest.hpp"
+
+namespace common {
+
+// Read-only memory mapping of a whole file. The mapped contents stay at the same address when
+// the mapping is moved, so that views into them survive moves.
+class MappedFile {
+ public:
+  static auto open(const std::filesystem::path& path) -> std::optional<MappedFile> {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return {};
+    }
+
+    struct stat status{};
+    if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode)) {
+      ::close(fd);
+      return {};
+    }
+
+    const auto size = std::size_t(status.st_size);
+    void* data = nullptr;
+    if (size > 0UZ) {
+      data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        ::close(fd);
+        return {};
+      }
+      ::madvise(data, size, MADV_SEQUENTIAL);
+    }
+    ::close(fd);
+
+    return MappedFile{data, size};
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+  MappedFile(MappedFile&& other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0UZ)) {}
+
+  auto operator=(MappedFile&& other) noexcept -> MappedFile& {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+  }
+
+  auto contents() const -> std::string_view { return {static_cast<const char*>(data_), size_}; }
+
+ private:
+  MappedFile(void* data, const std::size_t size) : data_(data), size_(size) {}
+
+  void* data_;
+  std::size_t size_;
+};
+
+// Contents of the input files of a part
+class Inputs {
+ public:
+  // Maps every file from `directory`, or reports the first one that cannot be read
+  static auto load(const std::vector<std::string>& files,
+                   const std::filesystem::path& directory = {})
+      -> std::expected<Inputs, std::string> {
+    Inputs result;
+    result.files_.reserve(files.size());
+    for (const auto& file : files) {
+      const auto path = directory / file;
+      auto mapped_file = MappedFile::open(path);
+      if (!mapped_file) {
+        return std::unexpected{path.string()};
+      }
+      result.sources_.push_back(mapped_file->contents());
+      result.files_.push_back(*std::move(mapped_file));
+    }
+    return result;
+  }
+
+  auto sources() const -> Sources { return sources_; }
+
+ private:
+  Inputs() = default;
+
+  std::vector<MappedFile> files_;
+  std::vector<std::string_view> sources_;
+};
+
+}  // namespace common
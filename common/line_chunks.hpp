@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/parallel.hpp"
+#include "common/text.hpp"
+
+namespace common {
+
+// Whole lines of a text, parsed as a unit by one thread
+struct LineChunk {
+  std::string_view text;
+  std::size_t first_row;  // Rank in the text of the first non-empty line of the chunk
+  std::size_t row_count;  // Number of non-empty lines
+  std::size_t max_width;  // Length of the longest line
+};
+
+struct LineChunks {
+  std::vector<LineChunk> chunks;
+  std::size_t row_count;
+  std::size_t max_width;
+};
+
+// Splits `text` at line boundaries into chunks of at least 1 MiB, a few per thread of the shared
+// pool, and counts their lines concurrently, so that the chunks can then be parsed concurrently
+// with known row numbers. Rows are numbered as the non-empty lines of `lines(text)`.
+inline auto split_lines(const std::string_view text) -> LineChunks {
+  constexpr std::size_t min_chunk_size = std::size_t{1} << 20U;
+  constexpr std::size_t chunks_per_thread = 4UZ;
+  const std::size_t target_count =
+      std::clamp(text.size() / min_chunk_size, 1UZ,
+                 chunks_per_thread * WorkStealingPool::shared().thread_count());
+
+  std::vector<std::size_t> bounds{0UZ};
+  for (std::size_t k = 1UZ; k < target_count; ++k) {
+    const std::size_t position =
+        text.find('\n', std::max(k * text.size() / target_count, bounds.back()));
+    if (position == std::string_view::npos || position + 1UZ == text.size()) {
+      break;
+    }
+    bounds.push_back(position + 1UZ);
+  }
+  bounds.push_back(text.size());
+
+  LineChunks result{.chunks = std::vector<LineChunk>(bounds.size() - 1UZ),
+                    .row_count = 0UZ,
+                    .max_width = 0UZ};
+  parallel_for(0UZ, result.chunks.size(), [&](const std::size_t rank) {
+    auto& chunk = result.chunks[rank];
+    chunk.text = text.substr(bounds[rank], bounds[rank + 1UZ] - bounds[rank]);
+    for (const std::string_view line : lines(chunk.text)) {
+      ++chunk.row_count;
+      chunk.max_width = std::max(chunk.max_width, line.size());
+    }
+  });
+
+  for (auto& chunk : result.chunks) {
+    chunk.first_row = result.row_count;
+    result.row_count += chunk.row_count;
+    result.max_width = std::max(result.max_width, chunk.max_width);
+  }
+  return result;
+}
+
+// Calls `body(row, line)` for every non-empty line, concurrently across the chunks
+template <typename Body>
+void parallel_for_lines(const LineChunks& chunks, const Body& body) {
+  parallel_for(0UZ, chunks.chunks.size(), [&](const std::size_t rank) {
+    const auto& chunk = chunks.chunks[rank];
+    std::size_t row = chunk.first_row;
+    for (const std::string_view line : lines(chunk.text)) {
+      body(row++, line);
+    }
+  });
+}
+
+// Values appended by `collect(row, line, values)` to the vector of every chunk, concurrently
+// across the chunks, concatenated in the order of the lines
+template <typename T, typename Collect>
+auto parallel_collect_lines(const LineChunks& chunks, const Collect& collect) -> std::vector<T> {
+  std::vector<std::vector<T>> chunk_values(chunks.chunks.size());
+  parallel_for(0UZ, chunks.chunks.size(), [&](const std::size_t rank) {
+    const auto& chunk = chunks.chunks[rank];
+    std::size_t row = chunk.first_row;
+    for (const std::string_view line : lines(chunk.text)) {
+      collect(row++, line, chunk_values[rank]);
+    }
+  });
+
+  if (chunk_values.size() == 1UZ) {
+    return std::move(chunk_values.front());
+  }
+  std::vector<T> result;
+  result.reserve(std::ranges::fold_left(chunk_values, 0UZ, [](const std::size_t size,
+                                                              const std::vector<T>& values) {
+    return size + values.size();
+  }));
+  for (auto& values : chunk_values) {
+    std::ranges::move(values, std::back_inserter(result));
+  }
+  return result;
+}
+
+}  // namespace common
@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/quest.hpp"
+#include "common/socket.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Nanoseconds = std::chrono::nanoseconds;
+
+struct Options {
+  std::filesystem::path socket{"solver.sock"};
+  std::size_t connection_count{1UZ};
+  std::size_t request_count{1000UZ};
+  std::filesystem::path directory{"."};
+  std::vector<std::string> quests;
+};
+
+constexpr std::string_view usage =
+    "Usage: loadgen [--socket PATH] [--connections N] [--requests N] [--directory DIR] "
+    "[QUEST...]\n"
+    "\n"
+    "Sends N requests on each of N concurrent connections to the solver daemon listening on\n"
+    "PATH, cycling through the parts of the given quests, or of all of them, and reports the\n"
+    "throughput and the latencies. The input files of quest QUEST are read from DIR/QUEST.";
+
+auto parse_count(const std::string_view text) -> std::optional<std::size_t> {
+  std::size_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  Options result;
+
+  for (auto arg_it = args.begin(); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    const auto value = [&]() -> std::optional<std::string_view> {
+      if (std::next(arg_it) == args.end()) {
+        return {};
+      }
+      return *++arg_it;
+    };
+
+    if (arg == "--socket") {
+      const auto path = value();
+      if (!path) {
+        return {};
+      }
+      result.socket = *path;
+    } else if (arg == "--connections") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.connection_count = *count;
+    } else if (arg == "--requests") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.request_count = *count;
+    } else if (arg == "--directory") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.directory = *directory;
+    } else if (arg.starts_with("--")) {
+      return {};
+    } else {
+      result.quests.emplace_back(arg);
+    }
+  }
+
+  return result;
+}
+
+// Header and input files of the requests for every part whose input files can be read
+auto make_requests(const Options& options) -> std::vector<std::string> {
+  std::vector<std::string> result;
+
+  for (const auto& quest : common::registry()) {
+    if (!options.quests.empty() && !std::ranges::contains(options.quests, quest.name)) {
+      continue;
+    }
+    for (const auto& [rank, part] : std::views::enumerate(quest.parts)) {
+      const auto inputs = common::Inputs::load(part.files, options.directory / quest.name);
+      if (!inputs) {
+        std::println(stderr, "Skipping {} part #{}: cannot read {}", quest.name, rank + 1,
+                     inputs.error());
+        continue;
+      }
+      std::string request = std::format("{} {}", quest.name, rank + 1);
+      for (const std::string_view source : inputs->sources()) {
+        std::format_to(std::back_inserter(request), " {}", source.size());
+      }
+      request += '\n';
+      for (const std::string_view source : inputs->sources()) {
+        request += source;
+      }
+      result.push_back(std::move(request));
+    }
+  }
+
+  return result;
+}
+
+struct Load {
+  std::vector<Nanoseconds> latencies;
+  std::size_t error_count{};
+  bool disconnected{};
+};
+
+// Requests sent in turn on one connection, starting from the one at `first`
+auto send_requests(const Options& options, const std::span<const std::string> requests,
+                   const std::size_t first) -> Load {
+  Load result;
+  result.latencies.reserve(options.request_count);
+
+  auto connection = common::Connection::connect(options.socket);
+  if (!connection) {
+    result.disconnected = true;
+    return result;
+  }
+
+  for (const std::size_t rank : std::views::iota(first, first + options.request_count)) {
+    const auto start = Clock::now();
+    if (!connection->write_all(requests[rank % requests.size()])) {
+      result.disconnected = true;
+      break;
+    }
+    const auto response = connection->read_line();
+    if (!response) {
+      result.disconnected = true;
+      break;
+    }
+    result.latencies.push_back(Clock::now() - start);
+    if (!response->starts_with("OK ")) {
+      ++result.error_count;
+    }
+  }
+
+  return result;
+}
+
+// Nearest-rank percentile of sorted samples
+auto percentile(const std::span<const Nanoseconds> samples, const double fraction) -> Nanoseconds {
+  const auto rank = std::size_t(std::ceil(fraction * double(samples.size())));
+  return samples[std::clamp(rank, 1UZ, samples.size()) - 1UZ];
+}
+
+auto microseconds(const Nanoseconds duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    return EXIT_FAILURE;
+  }
+
+  const auto requests = make_requests(*options);
+  if (requests.empty()) {
+    std::println(stderr, "No request to send");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Load> loads(options->connection_count);
+  const auto start = Clock::now();
+  {
+    std::vector<std::jthread> clients;
+    for (auto&& [rank, load] : std::views::enumerate(loads)) {
+      clients.emplace_back([&options, &requests, &load, first = std::size_t(rank)]() {
+        load = send_requests(*options, requests, first);
+      });
+    }
+  }
+  const auto elapsed = Clock::now() - start;
+
+  std::vector<Nanoseconds> latencies;
+  std::size_t error_count{};
+  for (const auto& load : loads) {
+    std::ranges::copy(load.latencies, std::back_inserter(latencies));
+    error_count += load.error_count;
+  }
+  if (latencies.empty()) {
+    std::println(stderr, "Cannot connect to {}", options->socket.string());
+    return EXIT_FAILURE;
+  }
+  std::ranges::sort(latencies);
+
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  std::println("{} requests on {} connections in {:.3f} s: {:.1f} requests/s, {} errors",
+               latencies.size(), options->connection_count, seconds,
+               double(latencies.size()) / seconds, error_count);
+  std::println("latency  min {:>12.3f} us  median {:>12.3f} us  p99 {:>12.3f} us",
+               microseconds(latencies.front()), microseconds(percentile(latencies, 0.5)),
+               microseconds(percentile(latencies, 0.99)));
+
+  const bool disconnected = std::ranges::any_of(loads, &Load::disconnected);
+  if (disconnected) {
+    std::println(stderr, "Some connections were lost");
+  }
+  return disconnected || error_count != 0UZ ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,291 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "common/checkpoint.hpp"
+#include "common/external_bfs.hpp"
+#include "common/input.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+#include "common/result_cache.hpp"
+#include "common/thread_pool.hpp"
+
+namespace {
+
+struct Options {
+  std::size_t thread_count{std::max(1U, std::thread::hardware_concurrency())};
+  std::optional<std::size_t> part_number;
+  common::CheckpointSettings checkpoints;
+  common::ExternalMemorySettings external_memory;
+  std::optional<std::filesystem::path> cache_directory;
+  std::vector<std::filesystem::path> paths;
+};
+
+constexpr std::string_view usage =
+    "Usage: main [--threads N] [--part N] [--checkpoint DIR] [--checkpoint-interval SECONDS]\n"
+    "            [--resume] [--external-memory DIR] [--memory-budget MB] [--cache]\n"
+    "            [--cache-directory DIR] [PATH...]\n"
+    "\n"
+    "Without paths, solves every part from its input files in the current directory.\n"
+    "Otherwise, solves every part, or only part N, of every file given or contained in a given\n"
+    "directory, concurrently on N threads. The file takes the place of the first input file of\n"
+    "the part, the other ones being read from the current directory. Answers are printed as\n"
+    "FILE<TAB>PART<TAB>ANSWER lines, as soon as they are available.\n"
+    "The longest searches save their state into DIR every SECONDS (60 by default), and resume\n"
+    "from there with --resume.\n"
+    "With --external-memory, the searches of the largest maps keep their frontiers in temporary\n"
+    "files of DIR, and sort them in MB megabytes of memory (64 by default).\n"
+    "With --cache, answers are looked up in, and saved to, DIR, which defaults to\n"
+    "$XDG_CACHE_HOME/everybody_codes_2024, and the hits and misses are reported at the end.";
+
+auto parse_count(const std::string_view text) -> std::optional<std::size_t> {
+  std::size_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  Options result;
+
+  for (auto arg_it = args.begin(); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    const auto value = [&]() -> std::optional<std::string_view> {
+      if (std::next(arg_it) == args.end()) {
+        return {};
+      }
+      return *++arg_it;
+    };
+
+    if (arg == "--threads") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.thread_count = *count;
+    } else if (arg == "--part") {
+      const auto number = value().and_then(parse_count);
+      if (!number || *number == 0UZ) {
+        return {};
+      }
+      result.part_number = *number;
+    } else if (arg == "--checkpoint") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.checkpoints.directory = *directory;
+    } else if (arg == "--checkpoint-interval") {
+      const auto seconds = value().and_then(parse_count);
+      if (!seconds) {
+        return {};
+      }
+      result.checkpoints.interval = std::chrono::seconds(*seconds);
+    } else if (arg == "--resume") {
+      result.checkpoints.resume = true;
+    } else if (arg == "--external-memory") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.external_memory.directory = *directory;
+    } else if (arg == "--memory-budget") {
+      const auto megabytes = value().and_then(parse_count);
+      if (!megabytes || *megabytes == 0UZ) {
+        return {};
+      }
+      result.external_memory.memory_budget = *megabytes << 20U;
+    } else if (arg == "--cache") {
+      const auto directory = common::ResultCache::default_directory();
+      if (!directory) {
+        return {};
+      }
+      result.cache_directory = result.cache_directory.value_or(*directory);
+    } else if (arg == "--cache-directory") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.cache_directory = *directory;
+    } else if (arg.starts_with("--")) {
+      return {};
+    } else {
+      result.paths.emplace_back(arg);
+    }
+  }
+
+  if (result.checkpoints.resume && !result.checkpoints.directory) {
+    return {};
+  }
+
+  return result;
+}
+
+// Answer of the part, from the cache when given and holding it
+auto solve(const common::Quest& quest, const std::size_t part_number, const common::Inputs& inputs,
+           common::ResultCache* const cache) -> std::string {
+  std::uint64_t key{};
+  if (cache != nullptr) {
+    key = cache->key(quest.name, part_number, inputs.sources());
+    if (auto answer = cache->find(key)) {
+      return *std::move(answer);
+    }
+  }
+
+  const auto& part = quest.parts[part_number - 1UZ];
+  const auto input = [&]() {
+    PROFILE_SCOPE(std::format("{} part #{} parse", quest.name, part_number));
+    return part.parse(inputs.sources());
+  }();
+  const auto answer = [&]() {
+    PROFILE_SCOPE(std::format("{} part #{} solve", quest.name, part_number));
+    return part.solve(input);
+  }();
+
+  if (cache != nullptr) {
+    cache->store(key, answer);
+  }
+  return answer;
+}
+
+auto part_numbers(const common::Quest& quest, const Options& options) -> std::vector<std::size_t> {
+  if (options.part_number) {
+    return {*options.part_number};
+  }
+  return std::views::iota(1UZ, quest.parts.size() + 1UZ) | std::ranges::to<std::vector>();
+}
+
+auto solve_inputs(const common::Quest& quest, const Options& options,
+                  common::ResultCache* const cache) -> int {
+  int status = EXIT_SUCCESS;
+
+  for (const std::size_t part_number : part_numbers(quest, options)) {
+    const auto inputs = common::Inputs::load(quest.parts[part_number - 1UZ].files);
+    if (!inputs) {
+      std::println(stderr, "Cannot read {}", inputs.error());
+      status = EXIT_FAILURE;
+      continue;
+    }
+    std::println("The answer to part #{} is {}", part_number,
+                 solve(quest, part_number, *inputs, cache));
+  }
+
+  return status;
+}
+
+// Files given, with the regular files of the directories given in name order
+auto batch_files(const std::span<const std::filesystem::path> paths)
+    -> std::vector<std::filesystem::path> {
+  std::vector<std::filesystem::path> result;
+  for (const auto& path : paths) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(path, error)) {
+      result.push_back(path);
+      continue;
+    }
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator{path, error}) {
+      if (entry.is_regular_file(error)) {
+        files.push_back(entry.path());
+      }
+    }
+    std::ranges::sort(files);
+    std::ranges::move(files, std::back_inserter(result));
+  }
+  return result;
+}
+
+auto solve_batch(const common::Quest& quest, const Options& options,
+                 common::ResultCache* const cache) -> int {
+  const auto files = batch_files(options.paths);
+
+  std::mutex output_mutex;
+  std::atomic<bool> failed{};
+
+  {
+    common::ThreadPool pool{options.thread_count};
+    for (const auto& file : files) {
+      for (const std::size_t part_number : part_numbers(quest, options)) {
+        pool.submit([&quest, &file, &output_mutex, &failed, cache, part_number]() {
+          auto input_files = quest.parts[part_number - 1UZ].files;
+          input_files.front() = file.string();
+          const auto inputs = common::Inputs::load(input_files);
+          if (!inputs) {
+            const std::scoped_lock lock{output_mutex};
+            std::println(stderr, "Cannot read {}", inputs.error());
+            failed = true;
+            return;
+          }
+          const auto answer = solve(quest, part_number, *inputs, cache);
+          const std::scoped_lock lock{output_mutex};
+          std::println("{}\t{}\t{}", file.string(), part_number, answer);
+          std::fflush(stdout);
+        });
+      }
+    }
+  }
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    return EXIT_FAILURE;
+  }
+  common::checkpoint_settings() = options->checkpoints;
+  common::external_memory_settings() = options->external_memory;
+
+  const auto& quests = common::registry();
+  if (options->part_number && std::ranges::any_of(quests, [&](const common::Quest& quest) {
+        return *options->part_number > quest.parts.size();
+      })) {
+    std::println(stderr, "No part #{}", *options->part_number);
+    return EXIT_FAILURE;
+  }
+
+  std::optional<common::ResultCache> cache;
+  if (options->cache_directory) {
+    cache.emplace(*options->cache_directory);
+  }
+  common::ResultCache* const cache_pointer = cache ? &*cache : nullptr;
+
+  int status = EXIT_SUCCESS;
+  for (const auto& quest : quests) {
+    const int quest_status = options->paths.empty()
+                                 ? solve_inputs(quest, *options, cache_pointer)
+                                 : solve_batch(quest, *options, cache_pointer);
+    if (quest_status != EXIT_SUCCESS) {
+      status = quest_status;
+    }
+  }
+
+  if (cache) {
+    std::println(stderr, "Result cache: {} hits, {} misses", cache->hits(), cache->misses());
+  }
+
+  return status;
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace common {
+
+// Work-stealing pool running the loops of `parallel_for` and `parallel_reduce`.
+//
+// A loop is a range of indices. Whoever takes a range splits it in halves, keeping the lower half
+// and queuing the upper one on its own deque, until the range is small enough to be run. Idle
+// workers steal the oldest, thus largest, ranges from the other deques. The thread waiting for a
+// loop takes part in it, so that loops can be nested.
+class WorkStealingPool {
+ public:
+  explicit WorkStealingPool(const std::size_t thread_count) : deques_(thread_count + 1UZ) {
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0UZ; i < thread_count; ++i) {
+      workers_.emplace_back([this, i]() { work(i); });
+    }
+  }
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  auto operator=(const WorkStealingPool&) -> WorkStealingPool& = delete;
+  WorkStealingPool(WorkStealingPool&&) = delete;
+  auto operator=(WorkStealingPool&&) -> WorkStealingPool& = delete;
+
+  ~WorkStealingPool() {
+    {
+      const std::scoped_lock lock{sleep_mutex_};
+      stopping_ = true;
+    }
+    wake_up_.notify_all();
+    workers_.clear();
+  }
+
+  // Pool shared by the solvers, with as many threads as the PARALLEL_THREADS environment variable
+  // tells, or as the hardware supports. The calling threads make up for one of them.
+  static auto shared() -> WorkStealingPool& {
+    static WorkStealingPool pool{default_thread_count() - 1UZ};
+    return pool;
+  }
+
+  auto thread_count() const -> std::size_t { return workers_.size() + 1UZ; }
+
+  // Calls `body(first, last)` on disjoint subranges covering [first, last) of at most `grain`
+  // indices, and returns once all of them are done
+  template <typename Body>
+  void run(const std::size_t first, const std::size_t last, const std::size_t grain,
+           const Body& body) {
+    if (first >= last) {
+      return;
+    }
+    Loop loop{
+        .invoke = [](const void* context, const std::size_t begin,
+                     const std::size_t end) { (*static_cast<const Body*>(context))(begin, end); },
+        .context = &body,
+        .grain = std::max(grain, 1UZ),
+        .remaining = last - first,
+    };
+    run_range({.loop = &loop, .first = first, .last = last});
+    while (loop.remaining.load(std::memory_order_acquire) != 0UZ) {
+      if (!run_one()) {
+        std::this_thread::yield();
+      }
+    }
+    if (loop.exception) {
+      std::rethrow_exception(loop.exception);
+    }
+  }
+
+ private:
+  struct Loop {
+    void (*invoke)(const void*, std::size_t, std::size_t);
+    const void* context;
+    std::size_t grain;
+    std::atomic<std::size_t> remaining;
+    std::mutex exception_mutex{};
+    std::exception_ptr exception{};
+  };
+
+  struct Range {
+    Loop* loop;
+    std::size_t first;
+    std::size_t last;
+  };
+
+  struct Deque {
+    std::mutex mutex;
+    std::deque<Range> ranges;
+  };
+
+  static auto default_thread_count() -> std::size_t {
+    const char* const variable = std::getenv("PARALLEL_THREADS");  // NOLINT(concurrency-mt-unsafe)
+    if (variable != nullptr) {
+      const std::string_view text{variable};
+      std::size_t count{};
+      const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), count);
+      if (error == std::errc{} && end == text.data() + text.size() && count != 0UZ) {
+        return count;
+      }
+    }
+    return std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  // Deque of the calling thread, the last one being shared by the threads outside of the pool
+  auto own_deque() -> Deque& {
+    return deques_[worker_index == no_worker ? deques_.size() - 1UZ : worker_index];
+  }
+
+  void push(const Range range) {
+    queued_count_.fetch_add(1UZ, std::memory_order_release);
+    {
+      auto& deque = own_deque();
+      const std::scoped_lock lock{deque.mutex};
+      deque.ranges.push_back(range);
+    }
+    // Going through the mutex of the sleepers ensures that none of them misses the notification
+    { const std::scoped_lock lock{sleep_mutex_}; }
+    wake_up_.notify_one();
+  }
+
+  // Newest range of the own deque, or else oldest range of another one
+  auto pop() -> std::optional<Range> {
+    auto& own = own_deque();
+    {
+      const std::scoped_lock lock{own.mutex};
+      if (!own.ranges.empty()) {
+        const Range result = own.ranges.back();
+        own.ranges.pop_back();
+        queued_count_.fetch_sub(1UZ, std::memory_order_relaxed);
+        return result;
+      }
+    }
+    for (auto& victim : deques_) {
+      const std::scoped_lock lock{victim.mutex};
+      if (!victim.ranges.empty()) {
+        const Range result = victim.ranges.front();
+        victim.ranges.pop_front();
+        queued_count_.fetch_sub(1UZ, std::memory_order_relaxed);
+        return result;
+      }
+    }
+    return {};
+  }
+
+  auto run_one() -> bool {
+    const auto range = pop();
+    if (range) {
+      run_range(*range);
+    }
+    return range.has_value();
+  }
+
+  void run_range(Range range) {
+    Loop& loop = *range.loop;
+    while (range.last - range.first > loop.grain) {
+      const std::size_t middle = range.first + ((range.last - range.first) / 2UZ);
+      push({.loop = &loop, .first = middle, .last = range.last});
+      range.last = middle;
+    }
+    try {
+      loop.invoke(loop.context, range.first, range.last);
+    } catch (...) {
+      const std::scoped_lock lock{loop.exception_mutex};
+      if (!loop.exception) {
+        loop.exception = std::current_exception();
+      }
+    }
+    loop.remaining.fetch_sub(range.last - range.first, std::memory_order_acq_rel);
+  }
+
+  void work(const std::size_t index) {
+    worker_index = index;
+    for (;;) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock lock{sleep_mutex_};
+      wake_up_.wait(lock, [this]() {
+        return stopping_ || queued_count_.load(std::memory_order_acquire) != 0UZ;
+      });
+      if (stopping_) {
+        return;
+      }
+    }
+  }
+
+  static constexpr std::size_t no_worker = static_cast<std::size_t>(-1);
+  static inline thread_local std::size_t worker_index = no_worker;
+
+  std::vector<Deque> deques_;
+  std::atomic<std::size_t> queued_count_{};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_up_;
+  bool stopping_{};
+  std::vector<std::jthread> workers_;
+};
+
+// Number of indices per task of a loop over `count` indices
+inline auto default_grain(const std::size_t count) -> std::size_t {
+  constexpr std::size_t tasks_per_thread = 8UZ;
+  return std::max(1UZ, count / (tasks_per_thread * WorkStealingPool::shared().thread_count()));
+}
+
+// Calls `body(i)` for every i in [first, last), concurrently on the shared pool
+template <typename Body>
+void parallel_for(const std::size_t first, const std::size_t last, const Body& body) {
+  WorkStealingPool::shared().run(first, last, default_grain(last - first),
+                                 [&body](const std::size_t begin, const std::size_t end) {
+                                   for (std::size_t i = begin; i < end; ++i) {
+                                     body(i);
+                                   }
+                                 });
+}
+
+// Reduction of `map(i)` for every i in [first, last) with `combine`, of which `identity` must be
+// the identity element. The indices are reduced in order by chunks whose bounds do not depend on
+// the number of threads, and the results of the chunks are then reduced in order, so that the
+// result is the same on any number of threads, even when `combine` is not associative.
+// Chunks hold at least `min_chunk_size` indices, so that ranges shorter than that make up a single
+// chunk, reduced by the calling thread: the default suits cheap terms, and expensive ones call for
+// a smaller size, down to 1.
+template <typename T, typename Map, typename Combine>
+auto parallel_reduce(const std::size_t first, const std::size_t last, const T& identity,
+                     const Map& map, const Combine& combine,
+                     const std::size_t min_chunk_size = 1024UZ) -> T {
+  constexpr std::size_t max_chunk_count = 256UZ;
+  const std::size_t count = last > first ? last - first : 0UZ;
+  const std::size_t chunk_size =
+      std::max({1UZ, min_chunk_size, (count + max_chunk_count - 1UZ) / max_chunk_count});
+  const std::size_t chunk_count = (count + chunk_size - 1UZ) / chunk_size;
+
+  std::vector<std::optional<T>> partials(chunk_count);
+  parallel_for(0UZ, chunk_count, [&](const std::size_t chunk) {
+    T partial = identity;
+    const std::size_t chunk_last = std::min(last, first + ((chunk + 1UZ) * chunk_size));
+    for (std::size_t i = first + (chunk * chunk_size); i < chunk_last; ++i) {
+      partial = combine(std::move(partial), map(i));
+    }
+    partials[chunk] = std::move(partial);
+  });
+
+  T result = identity;
+  for (auto& partial : partials) {
+    result = combine(std::move(result), *std::move(partial));
+  }
+  return result;
+}
+
+}  // namespace common
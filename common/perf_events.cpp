@@ -0,0 +1,135 @@
+#include "common/perf_events.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <utility>
+
+namespace common::perf {
+
+namespace {
+
+auto attributes(const Event event) -> perf_event_attr {
+  constexpr auto cache_read_miss = [](const std::uint64_t cache) {
+    return cache | (std::uint64_t{PERF_COUNT_HW_CACHE_OP_READ} << 8U) |
+           (std::uint64_t{PERF_COUNT_HW_CACHE_RESULT_MISS} << 16U);
+  };
+
+  perf_event_attr result{};
+  result.size = sizeof(result);
+  result.type = PERF_TYPE_HARDWARE;
+  switch (event) {
+    case Event::cycles:
+      result.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case Event::instructions:
+      result.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case Event::l1d_misses:
+      result.type = PERF_TYPE_HW_CACHE;
+      result.config = cache_read_miss(PERF_COUNT_HW_CACHE_L1D);
+      break;
+    case Event::llc_misses:
+      result.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case Event::branch_misses:
+      result.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case Event::dtlb_misses:
+      result.type = PERF_TYPE_HW_CACHE;
+      result.config = cache_read_miss(PERF_COUNT_HW_CACHE_DTLB);
+      break;
+  }
+  result.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  result.disabled = 1U;
+  result.exclude_kernel = 1U;
+  result.exclude_hv = 1U;
+  return result;
+}
+
+}  // namespace
+
+auto name(const Event event) -> std::string_view {
+  switch (event) {
+    case Event::cycles:
+      return "cycles";
+    case Event::instructions:
+      return "instructions";
+    case Event::l1d_misses:
+      return "L1d misses";
+    case Event::llc_misses:
+      return "LLC misses";
+    case Event::branch_misses:
+      return "branch misses";
+    case Event::dtlb_misses:
+      return "dTLB misses";
+  }
+  std::unreachable();
+}
+
+Counters::Counters() {
+  for (auto&& [fd, event] : std::views::zip(fds_, all_events)) {
+    auto attr = attributes(event);
+    fd = int(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    if (fd < 0) {
+      error_ = errno;
+    }
+  }
+}
+
+Counters::~Counters() {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+}
+
+auto Counters::available() const -> bool {
+  return std::ranges::any_of(fds_, [](const int fd) { return fd >= 0; });
+}
+
+auto Counters::error() const -> std::string_view { return std::strerror(error_); }
+
+void Counters::start() {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+auto Counters::stop() -> Readings {
+  Readings result;
+  for (auto&& [fd, reading] : std::views::zip(fds_, result)) {
+    if (fd < 0) {
+      continue;
+    }
+    ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    struct {
+      std::uint64_t value;
+      std::uint64_t time_enabled;
+      std::uint64_t time_running;
+    } data{};
+    if (::read(fd, &data, sizeof(data)) != sizeof(data) || data.time_running == 0U) {
+      continue;
+    }
+    reading = data.time_running == data.time_enabled
+                  ? data.value
+                  : std::uint64_t(double(data.value) * double(data.time_enabled) /
+                                  double(data.time_running));
+  }
+  return result;
+}
+
+}  // namespace common::perf
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace common::perf {
+
+enum class Event : std::uint8_t {
+  cycles,
+  instructions,
+  l1d_misses,
+  llc_misses,
+  branch_misses,
+  dtlb_misses,
+};
+
+constexpr std::size_t event_count = 6UZ;
+
+constexpr std::array<Event, event_count> all_events{
+    Event::cycles,     Event::instructions,  Event::l1d_misses,
+    Event::llc_misses, Event::branch_misses, Event::dtlb_misses,
+};
+
+auto name(Event event) -> std::string_view;
+
+// Counts indexed by event, missing for the events that cannot be counted
+using Readings = std::array<std::optional<std::uint64_t>, event_count>;
+
+// Hardware event counters of the calling thread, in user space, through perf_event_open.
+// Events unsupported by the CPU, the kernel or the sandbox (as in most containers) are left out,
+// so that the counters can be used unconditionally.
+class Counters {
+ public:
+  Counters();
+  ~Counters();
+
+  Counters(const Counters&) = delete;
+  auto operator=(const Counters&) -> Counters& = delete;
+  Counters(Counters&&) = delete;
+  auto operator=(Counters&&) -> Counters& = delete;
+
+  // Whether any event can be counted, otherwise why not
+  auto available() const -> bool;
+  auto error() const -> std::string_view;
+
+  // Resets the counts and counts the events from now on
+  void start();
+
+  // Stops counting, and returns the counts since the start, extrapolated when the kernel had to
+  // share the hardware counters between the events
+  auto stop() -> Readings;
+
+ private:
+  std::array<int, event_count> fds_{};
+  int error_{};
+};
+
+}  // namespace common::perf
@@ -0,0 +1,206 @@
+#pragma once
+
+// Hot-path instrumentation, compiled in by the ENABLE_PROFILING CMake option.
+//
+// PROFILE_SCOPE(name) times the enclosing scope as a phase of the timeline, and
+// PROFILE_COUNT(name, value) accumulates a sample into a named counter. When profiling is
+// disabled, both expand to nothing and their arguments are not evaluated.
+//
+// When profiling is enabled, the timeline is written at exit as a Chrome trace (to be loaded in
+// chrome://tracing or https://ui.perfetto.dev) to the path given by the PROFILE_TRACE environment
+// variable, "trace.json" by default, and the counters are summarized on the standard error.
+
+#if defined(ENABLE_PROFILING)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <print>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace common::profile {
+
+using Clock = std::chrono::steady_clock;
+
+class Counter {
+ public:
+  explicit Counter(std::string name) : name_(std::move(name)) {}
+
+  void add(const std::uint64_t value) {
+    samples_.fetch_add(1U, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    std::uint64_t max = max_.load(std::memory_order_relaxed);
+    while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  auto name() const -> const std::string& { return name_; }
+  auto samples() const { return samples_.load(std::memory_order_relaxed); }
+  auto sum() const { return sum_.load(std::memory_order_relaxed); }
+  auto max() const { return max_.load(std::memory_order_relaxed); }
+
+ private:
+  std::string name_;
+  std::atomic<std::uint64_t> samples_{};
+  std::atomic<std::uint64_t> sum_{};
+  std::atomic<std::uint64_t> max_{};
+};
+
+struct Phase {
+  std::string name;
+  std::size_t thread;
+  Clock::time_point start;
+  Clock::time_point stop;
+};
+
+// Phases and counters of the whole process, reported when it exits
+class Profile {
+ public:
+  static auto instance() -> Profile& {
+    static Profile profile;
+    return profile;
+  }
+
+  Profile(const Profile&) = delete;
+  auto operator=(const Profile&) -> Profile& = delete;
+  Profile(Profile&&) = delete;
+  auto operator=(Profile&&) -> Profile& = delete;
+
+  ~Profile() {
+    const char* const path = std::getenv("PROFILE_TRACE");  // NOLINT(concurrency-mt-unsafe)
+    write_trace(path != nullptr ? path : "trace.json");
+    summarize_counters();
+  }
+
+  auto counter(const std::string_view name) -> Counter& {
+    const std::scoped_lock lock{mutex_};
+    const auto found = std::ranges::find(counters_, name, &Counter::name);
+    if (found != counters_.end()) {
+      return *found;
+    }
+    return counters_.emplace_back(std::string{name});
+  }
+
+  void record(Phase phase) {
+    const std::scoped_lock lock{mutex_};
+    phases_.push_back(std::move(phase));
+  }
+
+  // Small dense identifier of the calling thread, for the timeline
+  auto thread_number() -> std::size_t {
+    const std::scoped_lock lock{mutex_};
+    const auto id = std::this_thread::get_id();
+    const auto found = std::ranges::find(threads_, id);
+    if (found != threads_.end()) {
+      return std::size_t(found - threads_.begin());
+    }
+    threads_.push_back(id);
+    return threads_.size() - 1UZ;
+  }
+
+ private:
+  Profile() = default;
+
+  void write_trace(const std::string& path) const {
+    std::ofstream out{path};
+    if (!out) {
+      std::println(stderr, "Cannot write {}", path);
+      return;
+    }
+
+    const auto microseconds = [](const Clock::duration duration) {
+      return std::chrono::duration<double, std::micro>(duration).count();
+    };
+
+    std::println(out, "{{\"traceEvents\": [");
+    for (const auto& phase : phases_) {
+      std::println(out,
+                   "  {{\"name\": \"{}\", \"ph\": \"X\", \"pid\": 0, \"tid\": {}, \"ts\": {:.3f}, "
+                   "\"dur\": {:.3f}}},",
+                   phase.name, phase.thread, microseconds(phase.start - epoch_),
+                   microseconds(phase.stop - phase.start));
+    }
+    // Counters are reported once, with their final values
+    const auto end = microseconds(Clock::now() - epoch_);
+    for (const auto& counter : counters_) {
+      std::println(out,
+                   "  {{\"name\": \"{}\", \"ph\": \"C\", \"pid\": 0, \"ts\": {:.3f}, "
+                   "\"args\": {{\"samples\": {}, \"sum\": {}, \"max\": {}}}}},",
+                   counter.name(), end, counter.samples(), counter.sum(), counter.max());
+    }
+    std::println(out, "  {{\"name\": \"end\", \"ph\": \"i\", \"pid\": 0, \"ts\": {:.3f}}}", end);
+    std::println(out, "]}}");
+  }
+
+  void summarize_counters() const {
+    for (const auto& counter : counters_) {
+      std::println(stderr, "{:<40} samples {:>12}  sum {:>16}  max {:>12}", counter.name(),
+                   counter.samples(), counter.sum(), counter.max());
+    }
+  }
+
+  Clock::time_point epoch_{Clock::now()};
+  std::mutex mutex_;
+  std::deque<Counter> counters_;
+  std::vector<Phase> phases_;
+  std::vector<std::thread::id> threads_;
+};
+
+class ScopedPhase {
+ public:
+  // The profile is instantiated before the start of the phase, so as to precede it on the timeline
+  explicit ScopedPhase(std::string name)
+      : profile_(Profile::instance()), name_(std::move(name)), start_(Clock::now()) {}
+
+  ScopedPhase(const ScopedPhase&) = delete;
+  auto operator=(const ScopedPhase&) -> ScopedPhase& = delete;
+  ScopedPhase(ScopedPhase&&) = delete;
+  auto operator=(ScopedPhase&&) -> ScopedPhase& = delete;
+
+  ~ScopedPhase() {
+    const auto stop = Clock::now();
+    profile_.record({.name = std::move(name_),
+                     .thread = profile_.thread_number(),
+                     .start = start_,
+                     .stop = stop});
+  }
+
+ private:
+  Profile& profile_;
+  std::string name_;
+  Clock::time_point start_;
+};
+
+}  // namespace common::profile
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+#define PROFILE_SCOPE(name) \
+  const common::profile::ScopedPhase PROFILE_CONCAT(profile_phase_, __LINE__) { name }
+
+// The counter is looked up once per call site
+#define PROFILE_COUNT(name, value)                                     \
+  do {                                                                 \
+    static common::profile::Counter& profile_counter =                 \
+        common::profile::Profile::instance().counter(name);            \
+    profile_counter.add(std::uint64_t(value));                         \
+  } while (false)
+
+#else
+
+#define PROFILE_SCOPE(name) static_cast<void>(0)
+#define PROFILE_COUNT(name, value) static_cast<void>(0)
+
+#endif
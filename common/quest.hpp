@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <any>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace common {
+
+// Contents of the input files of a part, in the order of `Part::files`
+using Sources = std::span<const std::string_view>;
+
+// A variant of the solving of a part, such as another setting of one of its parameters, that is
+// checked against a reference solving of its own on the inputs of the part
+struct Variant {
+  std::string name;
+  std::function<std::string(const std::any&)> solve;
+  std::function<std::string(const std::any&)> reference;
+};
+
+// A part of a quest, split into its parsing and solving phases so that drivers can run them
+// separately. The parsed input is type-erased and the answer is rendered as text. The parsed input
+// may refer to the sources, which must outlive it.
+// A part whose solving has been optimized may keep its former, straightforward solving as a
+// reference, which must give the same answers.
+struct Part {
+  std::vector<std::string> files;
+  std::function<std::any(Sources)> parse;
+  std::function<std::string(const std::any&)> solve;
+  std::function<std::string(const std::any&)> reference;
+  std::vector<Variant> variants;
+};
+
+// Selects the implementation of the solving functions that have a reference one
+enum class Engine : std::uint8_t { optimized, reference };
+
+struct Quest {
+  std::string name;
+  std::vector<Part> parts;
+};
+
+template <typename Input, typename Solve>
+auto erase_solve(Solve solve) -> std::function<std::string(const std::any&)> {
+  return [solve = std::move(solve)](const std::any& input) {
+    return std::format("{}", solve(std::any_cast<const Input&>(input)));
+  };
+}
+
+template <typename Parse, typename Solve>
+auto make_part(std::vector<std::string> files, Parse parse, Solve solve) -> Part {
+  using Input = std::invoke_result_t<Parse&, Sources>;
+  return {
+      .files = std::move(files),
+      .parse = [parse = std::move(parse)](const Sources sources) -> std::any {
+        return parse(sources);
+      },
+      .solve = erase_solve<Input>(std::move(solve)),
+      .reference = {},
+      .variants = {},
+  };
+}
+
+template <typename Parse, typename Solve, typename Reference>
+auto make_part(std::vector<std::string> files, Parse parse, Solve solve, Reference reference)
+    -> Part {
+  using Input = std::invoke_result_t<Parse&, Sources>;
+  auto result = make_part(std::move(files), std::move(parse), std::move(solve));
+  result.reference = erase_solve<Input>(std::move(reference));
+  return result;
+}
+
+template <typename Input, typename Solve, typename Reference>
+auto make_variant(std::string name, Solve solve, Reference reference) -> Variant {
+  return {
+      .name = std::move(name),
+      .solve = erase_solve<Input>(std::move(solve)),
+      .reference = erase_solve<Input>(std::move(reference)),
+  };
+}
+
+// Quests linked into the current executable, sorted by name
+inline auto registry() -> std::vector<Quest>& {
+  static std::vector<Quest> quests;
+  return quests;
+}
+
+inline auto register_quest(Quest quest) -> bool {
+  auto& quests = registry();
+  const auto position = std::ranges::upper_bound(quests, quest.name, {}, &Quest::name);
+  quests.insert(position, std::move(quest));
+  return true;
+}
+
+}  // namespace common
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+namespace common {
+
+// Precomputations that a long-running process keeps across its requests, such as the tables that a
+// solver derives from its parameters or from one of its input files, so that the requests that need
+// the same ones find them ready.
+//
+// Values are keyed by their type and by a hash of what they are computed from, and the least
+// recently used ones are dropped beyond the capacity. The capacity is zero, so that nothing is
+// kept, unless the driver sets it, as only the daemon serves more than one request. Thread-safe.
+class ResidentStore {
+ public:
+  void set_capacity(const std::size_t capacity) {
+    const std::scoped_lock lock{mutex_};
+    capacity_ = capacity;
+    evict();
+  }
+
+  // Value of the key, which is computed by `compute()` unless a resident one is `usable(value)`,
+  // and then replaces it
+  template <typename T, typename Compute, typename Usable>
+  auto get(const std::uint64_t key, const Compute& compute, const Usable& usable)
+      -> std::shared_ptr<const T> {
+    const Key typed_key{.type = typeid(T), .hash = key};
+    bool keeps_values{};
+    {
+      const std::scoped_lock lock{mutex_};
+      keeps_values = capacity_ != 0UZ;
+      if (keeps_values) {
+        if (const auto found = entries_.find(typed_key); found != entries_.end()) {
+          auto value = std::static_pointer_cast<const T>(found->second->second);
+          if (usable(*value)) {
+            recency_.splice(recency_.begin(), recency_, found->second);
+            ++hit_count_;
+            return value;
+          }
+        }
+        ++miss_count_;
+      }
+    }
+
+    // Computed without holding the lock, so that other threads may compute values concurrently
+    auto value = std::make_shared<const T>(compute());
+    if (!keeps_values) {
+      return value;
+    }
+
+    const std::scoped_lock lock{mutex_};
+    if (const auto found = entries_.find(typed_key); found != entries_.end()) {
+      recency_.erase(found->second);
+      entries_.erase(found);
+    }
+    recency_.emplace_front(typed_key, value);
+    entries_.emplace(typed_key, recency_.begin());
+    evict();
+    return value;
+  }
+
+  template <typename T, typename Compute>
+  auto get(const std::uint64_t key, const Compute& compute) -> std::shared_ptr<const T> {
+    return get<T>(key, compute, [](const T& /*value*/) { return true; });
+  }
+
+  auto statistics() -> std::pair<std::size_t, std::size_t> {
+    const std::scoped_lock lock{mutex_};
+    return {hit_count_, miss_count_};
+  }
+
+ private:
+  struct Key {
+    std::type_index type;
+    std::uint64_t hash;
+
+    auto operator==(const Key&) const -> bool = default;
+  };
+
+  struct KeyHash {
+    auto operator()(const Key& key) const -> std::size_t {
+      return std::hash<std::type_index>{}(key.type) ^ std::size_t(key.hash);
+    }
+  };
+
+  using Entry = std::pair<Key, std::shared_ptr<const void>>;
+
+  void evict() {
+    while (recency_.size() > capacity_) {
+      entries_.erase(recency_.back().first);
+      recency_.pop_back();
+    }
+  }
+
+  std::mutex mutex_;
+  std::size_t capacity_{};
+  // Most recently used first
+  std::list<Entry> recency_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries_;
+  std::size_t hit_count_{};
+  std::size_t miss_count_{};
+};
+
+// Store of the current process
+inline auto resident_store() -> ResidentStore& {
+  static ResidentStore store;
+  return store;
+}
+
+}  // namespace common
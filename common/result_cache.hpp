@@ -0,0 +1,118 @@
+#pragma once
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "common/hash.hpp"
+#include "common/input.hpp"
+#include "common/quest.hpp"
+
+namespace common {
+
+// On-disk cache of the answers of the parts, addressed by a digest of their input files, of the
+// quest and part numbers and of the executable itself, so that rebuilding a solver invalidates its
+// answers. Without a readable executable, nothing is ever found. Lookups are counted, and are safe
+// from concurrent threads and processes: answers are written to temporary files renamed into place.
+class ResultCache {
+ public:
+  explicit ResultCache(std::filesystem::path directory)
+      : directory_(std::move(directory)), executable_digest_(executable_digest()) {}
+
+  // $XDG_CACHE_HOME/everybody_codes_2024, or ~/.cache/everybody_codes_2024, or none without
+  // either variable
+  static auto default_directory() -> std::optional<std::filesystem::path> {
+    constexpr std::string_view name = "everybody_codes_2024";
+    // NOLINTBEGIN(concurrency-mt-unsafe)
+    if (const char* const cache_home = std::getenv("XDG_CACHE_HOME");
+        cache_home != nullptr && *cache_home != '\0') {
+      return std::filesystem::path{cache_home} / name;
+    }
+    if (const char* const home = std::getenv("HOME"); home != nullptr && *home != '\0') {
+      return std::filesystem::path{home} / ".cache" / name;
+    }
+    // NOLINTEND(concurrency-mt-unsafe)
+    return {};
+  }
+
+  auto key(const std::string_view quest, const std::size_t part_number,
+           const Sources sources) const -> std::uint64_t {
+    std::uint64_t result = hash_bytes(quest, executable_digest_.value_or(0U) ^ part_number);
+    for (const std::string_view source : sources) {
+      result = hash_bytes(source, result);
+    }
+    return result;
+  }
+
+  auto find(const std::uint64_t key) -> std::optional<std::string> {
+    std::ifstream file;
+    if (executable_digest_) {
+      file.open(path(key), std::ios::binary);
+    }
+    if (!file.is_open()) {
+      misses_.fetch_add(1UZ, std::memory_order_relaxed);
+      return {};
+    }
+    hits_.fetch_add(1UZ, std::memory_order_relaxed);
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  }
+
+  // Whether the answer could be written
+  auto store(const std::uint64_t key, const std::string_view answer) const -> bool {
+    if (!executable_digest_) {
+      return false;
+    }
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+    const auto final_path = path(key);
+    auto temporary_path = final_path;
+    temporary_path += std::format(".{}-{:x}.tmp", ::getpid(),
+                                  std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+      std::ofstream file{temporary_path, std::ios::binary | std::ios::trunc};
+      file.write(answer.data(), std::streamsize(answer.size()));
+      if (!file.flush()) {
+        return false;
+      }
+    }
+    std::filesystem::rename(temporary_path, final_path, error);
+    return !error;
+  }
+
+  auto hits() const -> std::size_t { return hits_.load(std::memory_order_relaxed); }
+  auto misses() const -> std::size_t { return misses_.load(std::memory_order_relaxed); }
+
+ private:
+  auto path(const std::uint64_t key) const -> std::filesystem::path {
+    return directory_ / std::format("{:016x}", key);
+  }
+
+  static auto executable_digest() -> std::optional<std::uint64_t> {
+    const auto executable = MappedFile::open("/proc/self/exe");
+    if (!executable) {
+      return {};
+    }
+    return hash_bytes(executable->contents());
+  }
+
+  std::filesystem::path directory_;
+  std::optional<std::uint64_t> executable_digest_;
+  std::atomic<std::size_t> hits_{};
+  std::atomic<std::size_t> misses_{};
+};
+
+}  // namespace common
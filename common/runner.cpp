@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <expected>
+#include <filesystem>
+#include <format>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "common/input.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+#include "common/thread_pool.hpp"
+
+namespace {
+
+struct Options {
+  std::size_t thread_count{std::max(1U, std::thread::hardware_concurrency())};
+  std::filesystem::path directory{"."};
+  std::vector<std::string> quests;
+};
+
+constexpr std::string_view usage =
+    "Usage: runner [--threads N] [--directory DIR] [QUEST...]\n"
+    "\n"
+    "Solves every part of the given quests, or of all of them, concurrently on N threads.\n"
+    "The input files of quest QUEST are read from DIR/QUEST. Answers are printed in order.";
+
+auto parse_count(const std::string_view text) -> std::optional<std::size_t> {
+  std::size_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  Options result;
+
+  for (auto arg_it = args.begin(); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    const auto value = [&]() -> std::optional<std::string_view> {
+      if (std::next(arg_it) == args.end()) {
+        return {};
+      }
+      return *++arg_it;
+    };
+
+    if (arg == "--threads") {
+      const auto count = value().and_then(parse_count);
+      if (!count || *count == 0UZ) {
+        return {};
+      }
+      result.thread_count = *count;
+    } else if (arg == "--directory") {
+      const auto directory = value();
+      if (!directory) {
+        return {};
+      }
+      result.directory = *directory;
+    } else if (arg.starts_with("--")) {
+      return {};
+    } else {
+      result.quests.emplace_back(arg);
+    }
+  }
+
+  return result;
+}
+
+// Answer of a part, or the path of the input file that cannot be read
+using Outcome = std::expected<std::string, std::string>;
+
+struct Job {
+  std::string_view quest;
+  std::size_t part;
+  std::future<Outcome> outcome;
+};
+
+auto run(const common::Quest& quest, const std::size_t part_number,
+         const std::filesystem::path& directory) -> Outcome {
+  const auto& part = quest.parts[part_number - 1UZ];
+  const auto inputs = common::Inputs::load(part.files, directory);
+  if (!inputs) {
+    return std::unexpected{inputs.error()};
+  }
+  const auto input = [&]() {
+    PROFILE_SCOPE(std::format("{} part #{} parse", quest.name, part_number));
+    return part.parse(inputs->sources());
+  }();
+  PROFILE_SCOPE(std::format("{} part #{} solve", quest.name, part_number));
+  return part.solve(input);
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    return EXIT_FAILURE;
+  }
+
+  const auto& quests = common::registry();
+  for (const auto& name : options->quests) {
+    if (!std::ranges::contains(quests, name, &common::Quest::name)) {
+      std::println(stderr, "Unknown quest {}", name);
+      return EXIT_FAILURE;
+    }
+  }
+
+  common::ThreadPool pool{options->thread_count};
+
+  std::vector<Job> jobs;
+  for (const auto& quest : quests) {
+    if (!options->quests.empty() && !std::ranges::contains(options->quests, quest.name)) {
+      continue;
+    }
+    const auto directory = options->directory / quest.name;
+    for (const std::size_t part_number : std::views::iota(1UZ, quest.parts.size() + 1UZ)) {
+      jobs.push_back({
+          .quest = quest.name,
+          .part = part_number,
+          .outcome = pool.submit(
+              [&quest, part_number, directory]() { return run(quest, part_number, directory); }),
+      });
+    }
+  }
+
+  // Answers are reported in submission order, each one as soon as it is available
+  int status = EXIT_SUCCESS;
+  for (auto& [quest, part, outcome] : jobs) {
+    const auto answer = outcome.get();
+    if (!answer) {
+      std::println(stderr, "Cannot read {}", answer.error());
+      status = EXIT_FAILURE;
+      continue;
+    }
+    std::println("{} part #{}: {}", quest, part, *answer);
+  }
+
+  return status;
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace common {
+
+namespace scan_detail {
+
+constexpr std::size_t block_size = 64UZ;
+
+// Bit i is set when data[i] is a decimal digit
+inline auto digit_mask(const char* data) -> std::uint64_t {
+#if defined(__SSE2__)
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i nine = _mm_set1_epi8(9);
+  std::uint64_t result{};
+  for (std::size_t lane = 0UZ; lane < block_size / 16UZ; ++lane) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + (16UZ * lane)));  // NOLINT
+    // Digits are the bytes whose unsigned distance to '0' is at most 9
+    const __m128i offset = _mm_sub_epi8(chunk, zero);
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(offset, nine), offset);
+    result |= std::uint64_t(std::uint32_t(_mm_movemask_epi8(is_digit))) << (16UZ * lane);
+  }
+  return result;
+#else
+  std::uint64_t result{};
+  for (std::size_t i = 0UZ; i < block_size; ++i) {
+    result |= std::uint64_t(std::uint8_t(data[i] - '0') < 10U) << i;
+  }
+  return result;
+#endif
+}
+
+// Calls `visit(mask, position)` with the digit mask of every block of `text`, the last one being
+// padded with non-digits
+template <typename F>
+void for_each_block(const std::string_view text, F&& visit) {
+  std::size_t position = 0UZ;
+  for (; position + block_size <= text.size(); position += block_size) {
+    visit(digit_mask(text.data() + position), position);
+  }
+
+  std::array<char, block_size> tail{};
+  std::ranges::fill(tail, ' ');
+  std::ranges::copy(text.substr(position), tail.begin());
+  visit(digit_mask(tail.data()), position);
+}
+
+inline auto load_word(const char* data) -> std::uint64_t {
+  std::uint64_t result{};
+  std::memcpy(&result, data, sizeof(result));
+  if constexpr (std::endian::native == std::endian::big) {
+    result = std::byteswap(result);
+  }
+  return result;
+}
+
+// Value of the eight digits of a little-endian word, converted at once. Zero bytes count as zeros.
+inline auto eight_digits(std::uint64_t word) -> std::uint64_t {
+  word = ((word & 0x0F0F0F0F0F0F0F0FU) * 2561U) >> 8U;
+  word = ((word & 0x00FF00FF00FF00FFU) * 6553601U) >> 16U;
+  return ((word & 0x0000FFFF0000FFFFU) * 42949672960001U) >> 32U;
+}
+
+// Value of the digits in [first, last), given that `begin` is the beginning of the text
+inline auto digits_value(const char* begin, const char* first, const char* last)
+    -> std::uint64_t {
+  const auto head_length = std::size_t(last - first - 1) % 8UZ + 1UZ;
+  const char* const head_last = first + head_length;
+
+  std::uint64_t result{};
+  if (head_last - begin >= 8) {
+    // The eight bytes ending with the head are readable, the leading ones are masked out
+    const std::uint64_t mask = ~std::uint64_t{} << (8UZ * (8UZ - head_length));
+    result = eight_digits(load_word(head_last - 8) & mask);
+  } else {
+    std::array<char, 8> padded{};
+    std::memcpy(padded.data() + (padded.size() - head_length), first, head_length);
+    result = eight_digits(load_word(padded.data()));
+  }
+
+  for (const char* data = head_last; data != last; data += 8) {
+    result = (result * 100'000'000U) + eight_digits(load_word(data));
+  }
+  return result;
+}
+
+}  // namespace scan_detail
+
+// Every integer of `text`, i.e. every maximal run of digits, preceded by a minus sign for signed
+// types. Anything else separates integers.
+//
+// Digit runs are located by a first vectorized pass that sizes the output, then converted eight
+// digits at a time by a second pass.
+template <std::integral T>
+auto scan_integers(const std::string_view text) -> std::vector<T> {
+  std::size_t count{};
+  std::uint64_t carry{};
+  scan_detail::for_each_block(text, [&](const std::uint64_t digits, std::size_t /*position*/) {
+    count += std::size_t(std::popcount(digits & ~((digits << 1U) | carry)));
+    carry = digits >> 63U;
+  });
+
+  std::vector<T> result(count);
+  auto out = result.begin();
+
+  std::size_t run_start{};
+  carry = 0U;
+  scan_detail::for_each_block(text, [&](const std::uint64_t digits, const std::size_t position) {
+    const std::uint64_t shifted = (digits << 1U) | carry;
+    const std::uint64_t starts = digits & ~shifted;
+    carry = digits >> 63U;
+
+    // Run starts and run ends, i.e. the first non-digits after runs, alternate
+    for (std::uint64_t events = starts | (~digits & shifted); events != 0U;
+         events &= events - 1U) {
+      const auto bit = std::size_t(std::countr_zero(events));
+      if (((starts >> bit) & 1U) != 0U) {
+        run_start = position + bit;
+        continue;
+      }
+
+      const auto value = T(scan_detail::digits_value(text.data(), text.data() + run_start,
+                                                     text.data() + position + bit));
+      if constexpr (std::is_signed_v<T>) {
+        *out++ = (run_start > 0UZ && text[run_start - 1UZ] == '-') ? T(-value) : value;
+      } else {
+        *out++ = value;
+      }
+    }
+  });
+
+  return result;
+}
+
+}  // namespace common
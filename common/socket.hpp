@@ -0,0 +1,126 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace common {
+
+// Stream connection over a Unix domain socket, used by the solver daemon and its clients.
+//
+// A request is a header line "QUEST PART SIZE..." followed by the contents of the input files of
+// the part, of the given sizes. The response is a line "OK ANSWER" or "ERROR MESSAGE".
+class Connection {
+ public:
+  explicit Connection(const int fd) : fd_(fd) {}
+
+  static auto connect(const std::filesystem::path& path) -> std::optional<Connection> {
+    const auto address = socket_address(path);
+    if (!address) {
+      return {};
+    }
+    Connection result{::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!result || ::connect(result.fd_, reinterpret_cast<const sockaddr*>(&*address),
+                             sizeof(*address)) != 0) {
+      return {};
+    }
+    return result;
+  }
+
+  Connection(const Connection&) = delete;
+  auto operator=(const Connection&) -> Connection& = delete;
+
+  Connection(Connection&& other) noexcept
+      : fd_(std::exchange(other.fd_, -1)), buffer_(std::move(other.buffer_)) {}
+
+  auto operator=(Connection&& other) noexcept -> Connection& {
+    std::swap(fd_, other.fd_);
+    std::swap(buffer_, other.buffer_);
+    return *this;
+  }
+
+  ~Connection() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  explicit operator bool() const { return fd_ >= 0; }
+
+  auto fd() const -> int { return fd_; }
+
+  // Line without its terminating newline, or nothing when the peer closed the connection first
+  auto read_line() -> std::optional<std::string> {
+    for (std::size_t searched = 0UZ;;) {
+      const auto end = buffer_.find('\n', searched);
+      if (end != std::string::npos) {
+        std::string result = buffer_.substr(0UZ, end);
+        buffer_.erase(0UZ, end + 1UZ);
+        return result;
+      }
+      searched = buffer_.size();
+      if (!fill()) {
+        return {};
+      }
+    }
+  }
+
+  auto read_exact(const std::size_t size) -> std::optional<std::string> {
+    while (buffer_.size() < size) {
+      if (!fill()) {
+        return {};
+      }
+    }
+    std::string result = buffer_.substr(0UZ, size);
+    buffer_.erase(0UZ, size);
+    return result;
+  }
+
+  auto write_all(std::string_view data) -> bool {
+    while (!data.empty()) {
+      const auto written = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
+      if (written <= 0) {
+        return false;
+      }
+      data.remove_prefix(std::size_t(written));
+    }
+    return true;
+  }
+
+  // Address of a socket file, unless its path is too long
+  static auto socket_address(const std::filesystem::path& path) -> std::optional<sockaddr_un> {
+    sockaddr_un result{};
+    result.sun_family = AF_UNIX;
+    const std::string& native = path.native();
+    if (native.size() >= sizeof(result.sun_path)) {
+      return {};
+    }
+    std::memcpy(&result.sun_path[0], native.c_str(), native.size() + 1UZ);
+    return result;
+  }
+
+ private:
+  auto fill() -> bool {
+    constexpr std::size_t chunk_size = 1UZ << 16U;
+    const std::size_t size = buffer_.size();
+    buffer_.resize(size + chunk_size);
+    const auto received = ::recv(fd_, buffer_.data() + size, chunk_size, 0);
+    buffer_.resize(size + std::size_t(std::max(received, decltype(received){0})));
+    return received > 0;
+  }
+
+  int fd_;
+  std::string buffer_;
+};
+
+}  // namespace common
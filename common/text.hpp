@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <string_view>
+#include <utility>
+
+namespace common {
+
+// Forward view over the maximal runs of `text` free of any of the `delimiters`, i.e. its
+// non-empty tokens. Tokens are views into `text`, which must outlive them.
+template <char... delimiters>
+class Tokens : public std::ranges::view_interface<Tokens<delimiters...>> {
+  static constexpr auto is_delimiter = [](const char c) { return ((c == delimiters) || ...); };
+
+ public:
+  class Iterator {
+   public:
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    Iterator(const std::string_view text, const std::size_t position) : text_(text) {
+      seek(position);
+    }
+
+    auto operator*() const -> std::string_view { return text_.substr(first_, last_ - first_); }
+
+    auto operator++() -> Iterator& {
+      seek(last_);
+      return *this;
+    }
+
+    auto operator++(int) -> Iterator {
+      Iterator result = *this;
+      ++*this;
+      return result;
+    }
+
+    auto operator==(const Iterator& other) const -> bool { return first_ == other.first_; }
+
+   private:
+    void seek(const std::size_t position) {
+      const auto first = std::find_if_not(text_.begin() + position, text_.end(), is_delimiter);
+      first_ = std::size_t(first - text_.begin());
+      if constexpr (sizeof...(delimiters) == 1UZ) {
+        // A single delimiter is looked for with memchr
+        last_ = std::min(text_.find(delimiters..., first_), text_.size());
+      } else {
+        last_ = std::size_t(std::find_if(first, text_.end(), is_delimiter) - text_.begin());
+      }
+    }
+
+    std::string_view text_;
+    std::size_t first_{};
+    std::size_t last_{};
+  };
+
+  Tokens() = default;
+
+  explicit Tokens(const std::string_view text) : text_(text) {}
+
+  auto begin() const -> Iterator { return {text_, 0UZ}; }
+  auto end() const -> Iterator { return {text_, text_.size()}; }
+
+ private:
+  std::string_view text_;
+};
+
+// Non-empty lines of `text`, without their end-of-line character
+inline auto lines(const std::string_view text) { return Tokens<'\n'>{text}; }
+
+// Tokens of `text` separated by whitespace
+inline auto words(const std::string_view text) { return Tokens<' ', '\t', '\r', '\n'>{text}; }
+
+// Non-empty fields of `text` separated by `delimiter`
+template <char delimiter>
+auto fields(const std::string_view text) {
+  return Tokens<delimiter>{text};
+}
+
+// Parts of `text` before and after the first `delimiter`, the latter being empty if there is none
+inline auto split_once(const std::string_view text, const char delimiter)
+    -> std::pair<std::string_view, std::string_view> {
+  const auto position = text.find(delimiter);
+  if (position == std::string_view::npos) {
+    return {text, {}};
+  }
+  return {text.substr(0UZ, position), text.substr(position + 1UZ)};
+}
+
+template <std::integral T>
+auto to_number(const std::string_view token) -> T {
+  T result{};
+  std::from_chars(token.data(), token.data() + token.size(), result);
+  return result;
+}
+
+}  // namespace common
+
+template <char... delimiters>
+inline constexpr bool std::ranges::enable_borrowed_range<common::Tokens<delimiters...>> = true;
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace common {
+
+// Fixed set of worker threads running the submitted tasks in submission order.
+// Pending tasks are still run when the pool is destroyed.
+class ThreadPool {
+ public:
+  explicit ThreadPool(const std::size_t thread_count) {
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0UZ; i < thread_count; ++i) {
+      workers_.emplace_back([this]() { work(); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+  ~ThreadPool() {
+    {
+      const std::scoped_lock lock{mutex_};
+      stopping_ = true;
+    }
+    ready_.notify_all();
+    workers_.clear();
+  }
+
+  template <typename F>
+  auto submit(F task) -> std::future<std::invoke_result_t<F&>> {
+    std::packaged_task<std::invoke_result_t<F&>()> packaged{std::move(task)};
+    auto result = packaged.get_future();
+    {
+      const std::scoped_lock lock{mutex_};
+      tasks_.emplace_back(std::move(packaged));
+    }
+    ready_.notify_one();
+    return result;
+  }
+
+ private:
+  void work() {
+    for (;;) {
+      std::move_only_function<void()> task;
+      {
+        std::unique_lock lock{mutex_};
+        ready_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::move_only_function<void()>> tasks_;
+  bool stopping_{};
+  std::vector<std::jthread> workers_;
+};
+
+}  // namespace common
@@ -0,0 +1,642 @@
+#include "gen/generators.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace gen {
+
+namespace {
+
+// Uniformly distributed integer in [low, high]
+template <typename T>
+auto uniform(Rng& rng, const T low, const T high) -> T {
+  return std::uniform_int_distribution<T>{low, high}(rng);
+}
+
+auto chance(Rng& rng, const double probability) -> bool {
+  return std::bernoulli_distribution{probability}(rng);
+}
+
+auto pick(Rng& rng, const std::string_view symbols) -> char {
+  return symbols[uniform(rng, 0UZ, symbols.size() - 1UZ)];
+}
+
+auto join_lines(const std::span<const std::string> lines) -> std::string {
+  std::string result;
+  result.reserve(std::ranges::fold_left(lines, 0UZ, [](const std::size_t acc, const auto& line) {
+    return acc + line.size() + 1UZ;
+  }));
+  for (const auto& line : lines) {
+    result.append(line);
+    result.push_back('\n');
+  }
+  return result;
+}
+
+// Next uppercase name of the same length in alphabetical order, if any
+auto increment(std::string& name) -> bool {
+  for (char& c : std::views::reverse(name)) {
+    if (c != 'Z') {
+      ++c;
+      return true;
+    }
+    c = 'A';
+  }
+  return false;
+}
+
+// Distinct uppercase names, ordered by length then alphabetically, skipping `reserved` ones
+auto make_names(const std::size_t count, const std::size_t min_length,
+                const std::span<const std::string_view> reserved = {}) -> std::vector<std::string> {
+  std::vector<std::string> result;
+  result.reserve(count);
+
+  for (std::size_t length = min_length; result.size() < count; ++length) {
+    std::string name(length, 'A');
+    do {  // NOLINT(cppcoreguidelines-avoid-do-while)
+      if (!std::ranges::contains(reserved, std::string_view{name})) {
+        result.push_back(name);
+      }
+    } while (result.size() < count && increment(name));
+  }
+
+  return result;
+}
+
+// Maze of `height` x `width` tiles made of walls '#' and open tiles '.'. Open tiles lie on odd
+// coordinates and are connected through a random spanning tree, to which a share of extra
+// passages is added so that the maze contains loops.
+auto carve_maze(Rng& rng, const std::size_t height, const std::size_t width,
+                const double loop_probability) -> std::vector<std::string> {
+  std::vector<std::string> result(height, std::string(width, '#'));
+
+  const std::size_t cell_rows = (height - 1UZ) / 2UZ;
+  const std::size_t cell_cols = (width - 1UZ) / 2UZ;
+  if (cell_rows == 0UZ || cell_cols == 0UZ) {
+    return result;
+  }
+
+  auto tile = [&](const std::size_t cell) -> char& {
+    return result[(2UZ * (cell / cell_cols)) + 1UZ][(2UZ * (cell % cell_cols)) + 1UZ];
+  };
+  auto wall = [&](const std::size_t a, const std::size_t b) -> char& {
+    const std::size_t row = (a / cell_cols) + (b / cell_cols) + 1UZ;
+    const std::size_t col = (a % cell_cols) + (b % cell_cols) + 1UZ;
+    return result[row][col];
+  };
+  auto neighbours = [&](const std::size_t cell) {
+    std::array<std::optional<std::size_t>, 4> candidates{};
+    const std::size_t i = cell / cell_cols;
+    const std::size_t j = cell % cell_cols;
+    if (i > 0UZ) {
+      candidates[0] = cell - cell_cols;
+    }
+    if (i + 1UZ < cell_rows) {
+      candidates[1] = cell + cell_cols;
+    }
+    if (j > 0UZ) {
+      candidates[2] = cell - 1UZ;
+    }
+    if (j + 1UZ < cell_cols) {
+      candidates[3] = cell + 1UZ;
+    }
+    return candidates;
+  };
+
+  std::vector<bool> visited(cell_rows * cell_cols, false);
+  std::vector<std::size_t> stack{uniform(rng, 0UZ, visited.size() - 1UZ)};
+  visited[stack.back()] = true;
+  tile(stack.back()) = '.';
+
+  while (!stack.empty()) {
+    const std::size_t current = stack.back();
+    std::array<std::size_t, 4> candidates{};
+    std::size_t candidate_count{};
+    for (const auto& neighbour : neighbours(current)) {
+      if (neighbour && !visited[*neighbour]) {
+        candidates[candidate_count++] = *neighbour;
+      }
+    }
+
+    if (candidate_count == 0UZ) {
+      stack.pop_back();
+      continue;
+    }
+
+    const std::size_t next = candidates[uniform(rng, 0UZ, candidate_count - 1UZ)];
+    visited[next] = true;
+    tile(next) = '.';
+    wall(current, next) = '.';
+    stack.push_back(next);
+  }
+
+  for (const std::size_t cell : std::views::iota(0UZ, visited.size())) {
+    for (const auto& neighbour : neighbours(cell)) {
+      if (neighbour && *neighbour > cell && chance(rng, loop_probability)) {
+        wall(cell, *neighbour) = '.';
+      }
+    }
+  }
+
+  return result;
+}
+
+// Random open tiles of a maze, all distinct
+auto open_locations(Rng& rng, const std::span<const std::string> maze, const std::size_t count)
+    -> std::vector<std::pair<std::size_t, std::size_t>> {
+  std::vector<std::pair<std::size_t, std::size_t>> result;
+  for (const auto& [i, row] : std::views::enumerate(maze)) {
+    for (const auto& [j, c] : std::views::enumerate(row)) {
+      if (c == '.') {
+        result.emplace_back(i, j);
+      }
+    }
+  }
+  std::ranges::shuffle(result, rng);
+  result.resize(std::min(count, result.size()));
+  return result;
+}
+
+auto input_file(const std::size_t part, std::string contents) -> File {
+  return {.name = std::format("input{}.txt", part), .contents = std::move(contents)};
+}
+
+auto generate_quest01(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  std::string monsters(size, 'x');
+  std::ranges::generate(monsters, [&]() { return pick(rng, part == 1UZ ? "ABC" : "ABCDx"); });
+  monsters.push_back('\n');
+  return {input_file(part, std::move(monsters))};
+}
+
+auto generate_quest02(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  constexpr std::string_view runes = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  constexpr std::size_t sentence_length = 200UZ;
+
+  const auto random_word = [&](const std::size_t min_length, const std::size_t max_length) {
+    std::string word(uniform(rng, min_length, max_length), 'A');
+    std::ranges::generate(word, [&]() { return pick(rng, runes); });
+    return word;
+  };
+
+  const auto words = std::views::iota(0UZ, size) |
+                     std::views::transform([&](auto) { return random_word(2UZ, 8UZ); }) |
+                     std::ranges::to<std::vector>();
+
+  std::vector<std::string> lines{"WORDS:" + (std::views::join_with(words, ',') |
+                                             std::ranges::to<std::string>()),
+                                 ""};
+
+  const std::size_t sentence_count = std::max(1UZ, size / 10UZ);
+  for (auto _ : std::views::iota(0UZ, sentence_count)) {
+    std::string sentence;
+    while (sentence.size() < sentence_length) {
+      if (part != 3UZ && !sentence.empty()) {
+        sentence.push_back(' ');
+      }
+      sentence.append(chance(rng, 0.5) ? words[uniform(rng, 0UZ, words.size() - 1UZ)]
+                                       : random_word(1UZ, 6UZ));
+    }
+    sentence.resize(sentence_length);
+    if (sentence.back() == ' ') {
+      sentence.back() = pick(rng, runes);
+    }
+    lines.push_back(std::move(sentence));
+  }
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest03(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  std::vector<std::string> lines(size, std::string(size, '.'));
+  const double center = double(size) / 2.0;
+  for (const auto& [i, line] : std::views::enumerate(lines)) {
+    for (const auto& [j, c] : std::views::enumerate(line)) {
+      const double di = (double(i) - center) / center;
+      const double dj = (double(j) - center) / center;
+      if ((di * di) + (dj * dj) < 0.8 && chance(rng, 0.97)) {
+        c = '#';
+      }
+    }
+  }
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_numbers(Rng& rng, const std::size_t count, const std::uint64_t low,
+                      const std::uint64_t high, const std::size_t per_line) -> std::string {
+  std::string result;
+  for (const std::size_t rank : std::views::iota(0UZ, count)) {
+    result.append(std::to_string(uniform(rng, low, high)));
+    result.push_back((rank + 1UZ) % per_line == 0UZ ? '\n' : ' ');
+  }
+  if (!result.empty()) {
+    result.back() = '\n';
+  }
+  return result;
+}
+
+auto generate_quest04(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  const std::uint64_t max_length = part == 3UZ ? 10'000'000U : 10'000U;
+  return {input_file(part, generate_numbers(rng, size, 1U, max_length, 1UZ))};
+}
+
+auto generate_quest05(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  // At least two rows, so that no column ever runs out of dancers. Two-digit numbers keep the
+  // count of distinct shouts low, so that the dance of parts 2 and 3 soon repeats itself.
+  const std::size_t dancer_count = std::max(8UZ, size - (size % 4UZ));
+  return {input_file(part, generate_numbers(rng, dancer_count, 1U, 99U, 4UZ))};
+}
+
+auto generate_quest06(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  // Fruits hang at a common depth, except a single one hanging one level deeper. All the names
+  // of the regular branches have the same length, so the path lengths only depend on the depth.
+  constexpr std::size_t max_node_count = 400'000UZ;
+  const std::size_t depth = std::max(2UZ, std::bit_width(size));
+  const std::size_t node_count = std::clamp(size, depth + 2UZ, max_node_count);
+
+  constexpr std::array<std::string_view, 3> reserved{{"RR", "BUG", "ANT"}};
+  const auto names = make_names(node_count, 4UZ, reserved);
+
+  std::vector<std::vector<std::string>> children(node_count + 1UZ);
+  std::vector<std::vector<std::size_t>> levels(depth + 1UZ);
+  levels[0].push_back(node_count);  // The root
+
+  for (const std::size_t node : std::views::iota(0UZ, node_count)) {
+    const std::size_t level = [&]() {
+      if (node < depth) {
+        return node + 1UZ;
+      }
+      if (node < depth + 2UZ) {
+        return depth;
+      }
+      return uniform(rng, 1UZ, depth);
+    }();
+    const auto& parents = levels[level - 1UZ];
+    const std::size_t parent = parents[uniform(rng, 0UZ, parents.size() - 1UZ)];
+    children[parent].push_back(names[node]);
+    levels[level].push_back(node);
+  }
+
+  const auto& fruit_bearers = levels[depth];
+  for (const std::size_t node : fruit_bearers) {
+    children[node].emplace_back("@");
+  }
+
+  // The deeper fruit hangs from a fresh branch attached to a fruit bearer
+  const std::size_t odd_parent = fruit_bearers[uniform(rng, 0UZ, fruit_bearers.size() - 1UZ)];
+  const auto odd_name = make_names(1UZ, 5UZ).front();
+  children[odd_parent].push_back(odd_name);
+
+  for (auto& branch_children : children) {
+    if (chance(rng, 0.05)) {
+      branch_children.emplace_back(chance(rng, 0.5) ? "BUG" : "ANT");
+    }
+  }
+
+  std::vector<std::string> lines;
+  for (const auto& [node, branch_children] : std::views::enumerate(children)) {
+    if (!branch_children.empty()) {
+      const std::string_view name =
+          std::size_t(node) == node_count ? "RR" : std::string_view{names[node]};
+      lines.push_back(std::format("{}:{}", name,
+                                  std::views::join_with(branch_children, ',') |
+                                      std::ranges::to<std::string>()));
+    }
+  }
+  lines.push_back(odd_name + ":@");
+  std::ranges::shuffle(lines, rng);
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_plan(Rng& rng, const std::size_t length) -> std::string {
+  return std::views::iota(0UZ, length) |
+         std::views::transform([&](auto) { return std::string{pick(rng, "+-=")}; }) |
+         std::views::join_with(',') | std::ranges::to<std::string>();
+}
+
+auto generate_quest07(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  constexpr std::string_view plan_ids = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+  if (part == 3UZ) {
+    // A single rival plan of 11 actions, raced over a long track
+    Files result{input_file(part, std::format("A:{}\n", generate_plan(rng, 11UZ)))};
+    const std::size_t side = std::max(3UZ, size / 4UZ);
+    std::vector<std::string> track(side, std::string(side, ' '));
+    for (const std::size_t k : std::views::iota(0UZ, side)) {
+      track.front()[k] = pick(rng, "+-==");
+      track.back()[k] = pick(rng, "+-==");
+      track[k].front() = pick(rng, "+-==");
+      track[k].back() = pick(rng, "+-==");
+    }
+    track.front().front() = 'S';
+    result.push_back({.name = "track3.txt", .contents = join_lines(track)});
+    return result;
+  }
+
+  const std::size_t plan_count = std::min(plan_ids.size(), std::max(1UZ, size / 100UZ));
+  const std::size_t plan_length = std::max(1UZ, size / plan_count);
+  std::string plans;
+  for (const char plan_id : plan_ids.substr(0UZ, plan_count)) {
+    plans.append(std::format("{}:{}\n", plan_id, generate_plan(rng, plan_length)));
+  }
+  Files result{input_file(part, std::move(plans))};
+
+  if (part == 2UZ) {
+    const std::size_t width = std::max(3UZ, size / 2UZ);
+    std::vector<std::string> track{std::string(width, '='), std::string(width, '=')};
+    for (const std::size_t k : std::views::iota(0UZ, width)) {
+      track.front()[k] = pick(rng, "+-==");
+      track.back()[k] = pick(rng, "+-==");
+    }
+    track.front().front() = 'S';
+    track.back().front() = pick(rng, "+-=");
+    track.insert(std::next(track.begin()), std::format("{}{}{}", pick(rng, "+-="),
+                                                       std::string(width - 2UZ, ' '),
+                                                       pick(rng, "+-=")));
+    result.push_back({.name = "track2.txt", .contents = join_lines(track)});
+  }
+
+  return result;
+}
+
+auto generate_quest08(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  return {input_file(part, std::format("{}\n", uniform(rng, 1UZ, std::max(1UZ, size))))};
+}
+
+auto generate_quest09(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  const std::uint64_t low = part == 3UZ ? 10'000U : 1U;
+  const std::uint64_t high = part == 3UZ ? 200'000U : 10'000U;
+  return {input_file(part, generate_numbers(rng, size, low, high, 1UZ))};
+}
+
+auto generate_quest10(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  constexpr std::size_t band_width = 16UZ;
+  constexpr std::string_view runes = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+  std::vector<std::string> lines;
+  for (std::size_t first = 0UZ; first < size; first += band_width) {
+    std::array<std::string, 8> band;
+    for (const std::size_t rank : std::views::iota(first, std::min(size, first + band_width))) {
+      // Distinct runes, so that every row and column share exactly one of them
+      std::string symbols{runes};
+      std::ranges::shuffle(symbols, rng);
+      std::array<std::string, 4> rows;
+      std::array<std::string, 4> cols;
+      for (const std::size_t i : std::views::iota(0UZ, 4UZ)) {
+        for (const std::size_t j : std::views::iota(0UZ, 4UZ)) {
+          rows[i].push_back(symbols[(4UZ * i) + j]);
+          cols[j].push_back(symbols[(4UZ * i) + j]);
+        }
+      }
+      for (auto& symbols_line : rows) {
+        std::ranges::shuffle(symbols_line, rng);
+      }
+      for (auto& symbols_line : cols) {
+        std::ranges::shuffle(symbols_line, rng);
+      }
+
+      std::array<std::string, 8> engraving;
+      for (const std::size_t k : std::views::iota(0UZ, 2UZ)) {
+        engraving[k] = std::format("**{}{}{}{}**", cols[0][k], cols[1][k], cols[2][k], cols[3][k]);
+        engraving[k + 6UZ] = std::format("**{}{}{}{}**", cols[0][k + 2UZ], cols[1][k + 2UZ],
+                                         cols[2][k + 2UZ], cols[3][k + 2UZ]);
+      }
+      for (const std::size_t i : std::views::iota(0UZ, 4UZ)) {
+        engraving[i + 2UZ] = std::format("{}....{}", rows[i].substr(0UZ, 2UZ), rows[i].substr(2UZ));
+      }
+
+      for (auto&& [line, engraving_line] : std::views::zip(band, engraving)) {
+        if (rank != first) {
+          line.push_back(' ');
+        }
+        line.append(engraving_line);
+      }
+    }
+    lines.insert(lines.end(), band.begin(), band.end());
+  }
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest11(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  constexpr std::array<std::string_view, 2> reserved{{"A", "Z"}};
+  auto categories = make_names(std::max(2UZ, size) - 2UZ, 2UZ, reserved);
+  categories.insert(categories.begin(), {"A", "Z"});
+
+  std::vector<std::string> lines;
+  for (const auto& category : categories) {
+    const auto children =
+        std::views::iota(0UZ, uniform(rng, 1UZ, 4UZ)) | std::views::transform([&](auto) {
+          return std::string_view{categories[uniform(rng, 0UZ, categories.size() - 1UZ)]};
+        }) |
+        std::views::join_with(',') | std::ranges::to<std::string>();
+    lines.push_back(std::format("{}:{}", category, children));
+  }
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest12(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  if (part == 3UZ) {
+    std::string meteors;
+    for (auto _ : std::views::iota(0UZ, size)) {
+      const std::size_t x = uniform(rng, 2UZ, std::max(2UZ, size));
+      const std::size_t y = uniform(rng, (x / 2UZ) + 1UZ, x + 2UZ);
+      meteors.append(std::format("{} {}\n", x, y));
+    }
+    return {input_file(part, std::move(meteors))};
+  }
+
+  const std::size_t width = std::max(4UZ, size);
+  const std::size_t height = std::max(4UZ, size / 4UZ);
+  std::vector<std::string> lines(height, std::string(width, '.'));
+  for (const auto& [y, line] : std::views::enumerate(std::views::reverse(lines))) {
+    for (const std::size_t x : std::views::iota(std::size_t(y) + 3UZ, width)) {
+      if (chance(rng, 0.02)) {
+        line[x] = part == 1UZ ? 'T' : pick(rng, "TTH");
+      }
+    }
+  }
+  for (const auto& [rank, segment] : std::views::enumerate(std::string_view{"ABC"})) {
+    lines[height - 1UZ - std::size_t(rank)][1] = segment;
+  }
+  lines.emplace_back(width, '=');
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest13(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  auto maze = carve_maze(rng, std::max(3UZ, size), std::max(3UZ, size), 0.2);
+
+  const std::size_t start_count = part == 3UZ ? std::max(1UZ, size / 8UZ) : 1UZ;
+  const auto locations = open_locations(rng, maze, start_count + 1UZ);
+  for (auto& row : maze) {
+    for (char& c : row) {
+      if (c == '.') {
+        c = pick(rng, "0123456789");
+      }
+    }
+  }
+  for (const auto& [rank, location] : std::views::enumerate(locations)) {
+    maze[location.first][location.second] = rank == 0 ? 'E' : 'S';
+  }
+
+  return {input_file(part, join_lines(maze))};
+}
+
+auto generate_quest14(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  const std::size_t plant_count = part == 1UZ ? 1UZ : std::max(3UZ, size / 1'000UZ);
+  const std::size_t segments_per_plant = std::max(2UZ, size / plant_count);
+
+  std::vector<std::string> lines;
+  for (auto _ : std::views::iota(0UZ, plant_count)) {
+    const std::size_t trunk = uniform(rng, 1UZ, std::max(1UZ, segments_per_plant / 4UZ));
+    std::vector<std::string> growths{std::format("U{}", trunk)};
+    std::size_t remaining = segments_per_plant - std::min(segments_per_plant, trunk);
+    while (remaining > 0UZ) {
+      const std::size_t length = std::min(remaining, uniform(rng, 1UZ, 10UZ));
+      growths.push_back(std::format("{}{}", pick(rng, "UUULRFBD"), length));
+      remaining -= length;
+    }
+    lines.push_back(std::views::join_with(growths, ',') | std::ranges::to<std::string>());
+  }
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest15(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  const std::size_t width = std::max(5UZ, size);
+  auto maze = carve_maze(rng, std::max(5UZ, width / 2UZ), width, 0.3);
+
+  constexpr std::array<std::string_view, 3> herb_types{{"H", "ABC", "ABCDE"}};
+  const std::string_view herbs = herb_types[std::min(part, 3UZ) - 1UZ];
+  const std::size_t herb_count = std::max(1UZ, size / 64UZ);
+
+  const auto locations = open_locations(rng, maze, herbs.size() * herb_count);
+  for (const auto& [rank, location] : std::views::enumerate(locations)) {
+    maze[location.first][location.second] = herbs[std::size_t(rank) % herbs.size()];
+  }
+  std::ranges::replace(maze.front(), '.', '#');
+  maze.front()[1] = '.';
+
+  return {input_file(part, join_lines(maze))};
+}
+
+auto generate_quest16(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  const std::size_t wheel_count = std::max(1UZ, size);
+
+  std::vector<std::vector<std::string>> wheels(wheel_count);
+  std::vector<std::size_t> step_sizes(wheel_count);
+  for (auto&& [faces, step_size] : std::views::zip(wheels, step_sizes)) {
+    step_size = uniform(rng, 1UZ, 20UZ);
+    faces.resize(uniform(rng, 3UZ, 12UZ));
+    std::ranges::generate(faces, [&]() {
+      return std::format("{}{}{}", pick(rng, "^-o*>"), pick(rng, "_.,"), pick(rng, "^-o*>"));
+    });
+  }
+
+  std::vector<std::string> lines{
+      std::views::transform(step_sizes, [](const std::size_t s) { return std::to_string(s); }) |
+          std::views::join_with(',') | std::ranges::to<std::string>(),
+      ""};
+  const std::size_t row_count = std::ranges::max(
+      std::views::transform(wheels, [](const auto& faces) { return faces.size(); }));
+  for (const std::size_t row : std::views::iota(0UZ, row_count)) {
+    lines.push_back(std::views::transform(wheels,
+                                          [row](const auto& faces) {
+                                            return row < faces.size() ? faces[row]
+                                                                      : std::string(3UZ, ' ');
+                                          }) |
+                    std::views::join_with(' ') | std::ranges::to<std::string>());
+  }
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest17(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  // Stars gather in clusters far enough apart to form distinct brilliant constellations
+  constexpr std::size_t cluster_side = 10UZ;
+  constexpr std::size_t cluster_spacing = cluster_side + 6UZ;
+  constexpr std::size_t stars_per_cluster = 20UZ;
+
+  const std::size_t cluster_count = std::max(3UZ, size / stars_per_cluster);
+  const auto clusters_per_row = std::size_t(std::ceil(std::sqrt(double(cluster_count))));
+  const std::size_t cluster_rows = (cluster_count + clusters_per_row - 1UZ) / clusters_per_row;
+
+  std::vector<std::string> lines(cluster_rows * cluster_spacing,
+                                 std::string(clusters_per_row * cluster_spacing, '.'));
+  for (const std::size_t cluster : std::views::iota(0UZ, cluster_count)) {
+    const std::size_t top = (cluster / clusters_per_row) * cluster_spacing;
+    const std::size_t left = (cluster % clusters_per_row) * cluster_spacing;
+    for (auto _ : std::views::iota(0UZ, stars_per_cluster)) {
+      const std::size_t row = top + uniform(rng, 0UZ, cluster_side - 1UZ);
+      const std::size_t col = left + uniform(rng, 0UZ, cluster_side - 1UZ);
+      lines[row][col] = '*';
+    }
+  }
+
+  return {input_file(part, join_lines(lines))};
+}
+
+auto generate_quest18(Rng& rng, const std::size_t part, const std::size_t size) -> Files {
+  const std::size_t side = std::max(5UZ, size) | 1UZ;
+  auto farm = carve_maze(rng, side, side, 0.1);
+
+  for (const auto& [row, col] : open_locations(rng, farm, std::max(1UZ, size))) {
+    farm[row][col] = 'P';
+  }
+  if (part != 3UZ) {
+    farm[1].front() = '.';
+  }
+  if (part == 2UZ) {
+    farm[side - 2UZ].back() = '.';
+  }
+
+  return {input_file(part, join_lines(farm))};
+}
+
+}  // namespace
+
+const std::array<Generator, 18> generators{{
+    {10'000'000UZ, "monsters in the battle log", generate_quest01},
+    {20'000UZ, "runic words, one sentence per ten words", generate_quest02},
+    {2'048UZ, "side of the mine", generate_quest03},
+    {10'000'000UZ, "nails", generate_quest04},
+    {1'000'000UZ, "dancers", generate_quest05},
+    {100'000UZ, "branches", generate_quest06},
+    {10'000UZ, "plan actions for parts 1 and 2, track length for part 3", generate_quest07},
+    {10'000'000UZ, "upper bound of the number", generate_quest08},
+    {10'000'000UZ, "sparkballs", generate_quest09},
+    {100'000UZ, "runic engravings", generate_quest10},
+    {10'000UZ, "termite categories", generate_quest11},
+    {10'000UZ, "field width for parts 1 and 2, meteors for part 3", generate_quest12},
+    {2'048UZ, "side of the maze", generate_quest13},
+    {1'000'000UZ, "plant segments", generate_quest14},
+    {1'024UZ, "width of the forest", generate_quest15},
+    {64UZ, "wheels", generate_quest16},
+    {100'000UZ, "stars", generate_quest17},
+    {4'096UZ, "side of the farm, also the number of palm trees", generate_quest18},
+}};
+
+auto generate(const std::size_t quest, const std::size_t part, const std::uint64_t seed,
+              const std::size_t size) -> Files {
+  Rng rng{seed ^ (std::uint64_t(quest) << 32U) ^ part};
+  return generators[quest - 1UZ].generate(rng, part, size);
+}
+
+}  // namespace gen
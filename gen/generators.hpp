@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gen {
+
+using Rng = std::mt19937_64;
+
+struct File {
+  std::string name;
+  std::string contents;
+};
+
+using Files = std::vector<File>;
+
+struct Generator {
+  std::size_t default_size;
+  std::string_view size_meaning;
+  std::function<Files(Rng&, std::size_t, std::size_t)> generate;
+};
+
+// Generators of quests 1 to 18, in order
+extern const std::array<Generator, 18> generators;
+
+// Synthetic input files of a part of quest number `quest`. The same seed always yields the same
+// files, and every part draws from its own stream so that it does not depend on the other ones.
+auto generate(std::size_t quest, std::size_t part, std::uint64_t seed, std::size_t size) -> Files;
+
+}  // namespace gen
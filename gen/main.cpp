@@ -0,0 +1,126 @@
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#include "gen/generators.hpp"
+
+namespace {
+
+struct Options {
+  std::size_t quest{};
+  std::optional<std::size_t> part;
+  std::uint64_t seed{};
+  std::optional<std::size_t> size;
+  std::filesystem::path output{"."};
+};
+
+constexpr std::string_view usage =
+    "Usage: gen QUEST [--part N] [--seed N] [--size N] [--output DIR]\n"
+    "\n"
+    "Writes synthetic inputs of quest QUEST (1 to 18) for part N, or for every part, into\n"
+    "directory DIR. The same seed always yields the same inputs. The meaning and the\n"
+    "default value of the size depend on the quest:";
+
+auto parse_number(const std::string_view text) -> std::optional<std::uint64_t> {
+  std::uint64_t result{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    return {};
+  }
+  return result;
+}
+
+auto parse_options(const std::span<char* const> args) -> std::optional<Options> {
+  if (args.empty()) {
+    return {};
+  }
+
+  Options result;
+
+  std::string_view quest = args.front();
+  if (quest.starts_with("quest")) {
+    quest.remove_prefix(5UZ);
+  }
+  const auto quest_number = parse_number(quest);
+  if (!quest_number || *quest_number == 0U || *quest_number > gen::generators.size()) {
+    return {};
+  }
+  result.quest = *quest_number;
+
+  for (auto arg_it = std::next(args.begin()); arg_it != args.end(); ++arg_it) {
+    const std::string_view arg = *arg_it;
+    if (std::next(arg_it) == args.end()) {
+      return {};
+    }
+    const std::string_view value = *++arg_it;
+
+    if (arg == "--output") {
+      result.output = value;
+      continue;
+    }
+
+    const auto number = parse_number(value);
+    if (!number) {
+      return {};
+    }
+    if (arg == "--part" && *number >= 1U && *number <= 3U) {
+      result.part = *number;
+    } else if (arg == "--seed") {
+      result.seed = *number;
+    } else if (arg == "--size" && *number > 0U) {
+      result.size = *number;
+    } else {
+      return {};
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+auto main(int argc, char* argv[]) -> int {
+  const auto options = parse_options(std::span{argv, std::size_t(argc)}.subspan(1));
+  if (!options) {
+    std::println(stderr, "{}", usage);
+    for (const auto& [rank, generator] : std::views::enumerate(gen::generators)) {
+      std::println(stderr, "  {:>2}: {} (default {})", rank + 1, generator.size_meaning,
+                   generator.default_size);
+    }
+    return EXIT_FAILURE;
+  }
+
+  const std::size_t size =
+      options->size.value_or(gen::generators[options->quest - 1UZ].default_size);
+
+  std::error_code error;
+  std::filesystem::create_directories(options->output, error);
+
+  for (const std::size_t part : std::views::iota(1UZ, 4UZ)) {
+    if (options->part && *options->part != part) {
+      continue;
+    }
+
+    for (const auto& [name, contents] : gen::generate(options->quest, part, options->seed, size)) {
+      const auto path = options->output / name;
+      std::ofstream out{path, std::ios::binary};
+      if (!out.write(contents.data(), std::streamsize(contents.size()))) {
+        std::println(stderr, "Cannot write {}", path.string());
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
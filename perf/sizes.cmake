@@ -0,0 +1,20 @@
+# Sizes given to gen for the inputs of the benchmark regression checks, so that every part takes
+# from milliseconds to a fraction of a second
+set(perf_size_quest01 1000000)
+set(perf_size_quest02 500)
+set(perf_size_quest03 512)
+set(perf_size_quest04 1000000)
+set(perf_size_quest05 100000)
+set(perf_size_quest06 20000)
+set(perf_size_quest07 300)
+set(perf_size_quest08 300000)
+set(perf_size_quest09 100000)
+set(perf_size_quest10 20000)
+set(perf_size_quest11 250)
+set(perf_size_quest12 2000)
+set(perf_size_quest13 512)
+set(perf_size_quest14 3000)
+set(perf_size_quest15 256)
+set(perf_size_quest16 32)
+set(perf_size_quest17 150)
+set(perf_size_quest18 256)
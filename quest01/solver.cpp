@@ -0,0 +1,456 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+
+namespace {
+
+// The battle log is solved straight from the text of the input, which can be larger than the memory
+auto parse_input(const std::string_view input) { return input; }
+
+auto required_potions(const char c) {
+  switch (c) {
+    case 'x':
+      [[fallthrough]];
+    case 'A':
+      return 0UZ;
+    case 'B':
+      return 1UZ;
+    case 'C':
+      return 3UZ;
+    case 'D':
+      return 5UZ;
+    default:
+      std::unreachable();
+  }
+}
+
+constexpr auto additional_potions(const std::size_t actual_monster_count) {
+  return (actual_monster_count * actual_monster_count) - actual_monster_count;
+}
+
+// Characters of the log, numbered as digits of the table indices of the groups
+using Symbol = std::uint8_t;
+
+constexpr std::size_t symbol_count = 5UZ;
+constexpr Symbol empty_symbol = 4U;  // 'x'
+constexpr Symbol no_symbol = 5U;     // Line feeds and the like, which are skipped
+
+constexpr auto symbols = [] {
+  std::array<Symbol, 256> result{};
+  std::ranges::fill(result, no_symbol);
+  result['A'] = 0U;
+  result['B'] = 1U;
+  result['C'] = 2U;
+  result['D'] = 3U;
+  result['x'] = empty_symbol;
+  return result;
+}();
+
+constexpr std::array<std::size_t, symbol_count> symbol_potions{0UZ, 1UZ, 3UZ, 5UZ, 0UZ};
+
+auto symbol(const char c) { return symbols[std::uint8_t(c)]; }
+
+// Index of a group in the table of the costs of the groups of its size
+using GroupIndex = std::uint32_t;
+
+// The costs of the groups up to this size are tabulated, in 5^8 bytes at most
+constexpr std::size_t max_table_group_size = 8UZ;
+// Larger tables are filled once at run time, as they exceed the constexpr evaluation limits
+constexpr std::size_t max_constexpr_group_size = 6UZ;
+
+// Potions for every group of `group_size` monsters, indexed by their symbols as base 5 digits, the
+// first one being the most significant
+template <std::size_t group_size>
+constexpr auto make_group_costs() {
+  constexpr std::size_t group_count = [] {
+    std::size_t result = 1UZ;
+    for (std::size_t i = 0UZ; i < group_size; ++i) {
+      result *= symbol_count;
+    }
+    return result;
+  }();
+
+  std::array<std::uint8_t, group_count> result{};
+  for (std::size_t index = 0UZ; index < group_count; ++index) {
+    std::size_t potions{};
+    std::size_t actual_monster_count{};
+    for (std::size_t digits = index, i = 0UZ; i < group_size; digits /= symbol_count, ++i) {
+      const std::size_t monster = digits % symbol_count;
+      potions += symbol_potions[monster];
+      actual_monster_count += monster != empty_symbol ? 1UZ : 0UZ;
+    }
+    result[index] = std::uint8_t(potions + additional_potions(actual_monster_count));
+  }
+  return result;
+}
+
+template <std::size_t group_size>
+auto group_costs() -> const auto& {
+  if constexpr (group_size <= max_constexpr_group_size) {
+    static constexpr auto table = make_group_costs<group_size>();
+    return table;
+  } else {
+    static const auto table = make_group_costs<group_size>();
+    return table;
+  }
+}
+
+constexpr std::size_t block_size = 64UZ;
+
+// Bit i of every mask is set when data[i] is of the class of the mask
+struct ClassMasks {
+  std::uint64_t monsters;
+  std::uint64_t b;
+  std::uint64_t c;
+  std::uint64_t d;
+  std::uint64_t x;
+};
+
+auto class_masks(const char* data) -> ClassMasks {
+  ClassMasks result{};
+#if defined(__SSE2__)
+  const __m128i a_bytes = _mm_set1_epi8('A');
+  const __m128i b_bytes = _mm_set1_epi8('B');
+  const __m128i c_bytes = _mm_set1_epi8('C');
+  const __m128i d_bytes = _mm_set1_epi8('D');
+  const __m128i x_bytes = _mm_set1_epi8('x');
+  for (std::size_t lane = 0UZ; lane < block_size / 16UZ; ++lane) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + (16UZ * lane)));  // NOLINT
+    const auto mask = [&](const __m128i bytes) {
+      return std::uint64_t(std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, bytes))))
+             << (16UZ * lane);
+    };
+    result.monsters |= mask(a_bytes);
+    result.b |= mask(b_bytes);
+    result.c |= mask(c_bytes);
+    result.d |= mask(d_bytes);
+    result.x |= mask(x_bytes);
+  }
+#else
+  for (std::size_t i = 0UZ; i < block_size; ++i) {
+    result.monsters |= std::uint64_t(data[i] == 'A') << i;
+    result.b |= std::uint64_t(data[i] == 'B') << i;
+    result.c |= std::uint64_t(data[i] == 'C') << i;
+    result.d |= std::uint64_t(data[i] == 'D') << i;
+    result.x |= std::uint64_t(data[i] == 'x') << i;
+  }
+#endif
+  result.monsters |= result.b | result.c | result.d | result.x;
+  return result;
+}
+
+// Groups larger than this are counted by their table only
+constexpr std::size_t max_kernel_group_size = 3UZ;
+
+// Potions for a stream of monsters in groups of tabulated size, fed by buffers of any size, in
+// constant memory: the group in progress is carried over from one buffer to the next.
+//
+// For the small groups, the blocks of 64 monsters are counted at once from the masks of their
+// monster classes. A group of n actual monsters calls for n * (n - 1) additional potions, i.e. two
+// for every pair of actual monsters in it, so that those of the complete groups of a block are
+// counted by matching the actual monster mask with itself shifted by the distances within a group.
+//
+// Otherwise, the monsters of a group make up its index in the table of the group costs, which is
+// looked up once the group is complete.
+template <std::size_t group_size>
+class PotionCounter {
+  static_assert(group_size != 0UZ && group_size <= max_table_group_size);
+
+ public:
+  void feed(const std::string_view buffer) {
+    std::size_t position = 0UZ;
+    if constexpr (group_size <= max_kernel_group_size) {
+      for (; position + block_size <= buffer.size(); position += block_size) {
+        feed_block(buffer.data() + position);
+      }
+    }
+    feed_monsters(buffer.substr(position));
+  }
+
+  // Potions for the monsters fed so far, the last group being possibly incomplete
+  auto total() const -> std::size_t {
+    // An incomplete group costs as much as the group completed with empty places
+    GroupIndex group = group_;
+    for (std::size_t i = monster_count_; i < group_size; ++i) {
+      group = (group * symbol_count) + empty_symbol;
+    }
+    return potions_ + group_costs<group_size>()[group];
+  }
+
+ private:
+  // Weights of the monsters of a group in its table index
+  static constexpr auto digit_weights = [] {
+    std::array<GroupIndex, group_size> result{};
+    GroupIndex weight = 1U;
+    for (std::size_t i = group_size; i-- > 0UZ;) {
+      result[i] = weight;
+      weight *= GroupIndex(symbol_count);
+    }
+    return result;
+  }();
+
+  void feed_monsters(const std::string_view monsters) {
+    // The state is kept in locals, which the characters of the monsters cannot alias
+    std::size_t potions = potions_;
+    std::size_t monster_count = monster_count_;
+    GroupIndex group = group_;
+    for (std::size_t position = 0UZ; position < monsters.size();) {
+      // Whole groups are indexed at once, rather than by a chain of dependent multiplications
+      if (monster_count == 0UZ && position + group_size <= monsters.size()) {
+        GroupIndex index{};
+        bool skipped{};
+        for (std::size_t i = 0UZ; i < group_size; ++i) {
+          const Symbol monster = symbol(monsters[position + i]);
+          index += monster * digit_weights[i];
+          skipped = skipped || monster == no_symbol;
+        }
+        if (!skipped) {
+          potions += group_costs<group_size>()[index];
+          position += group_size;
+          continue;
+        }
+      }
+
+      const Symbol monster = symbol(monsters[position++]);
+      if (monster == no_symbol) {
+        continue;
+      }
+      group = (group * symbol_count) + monster;
+      if (++monster_count == group_size) {
+        potions += group_costs<group_size>()[group];
+        group = 0U;
+        monster_count = 0UZ;
+      }
+    }
+    potions_ = potions;
+    monster_count_ = monster_count;
+    group_ = group;
+  }
+
+  void feed_block(const char* data) {
+    const ClassMasks masks = class_masks(data);
+    if (masks.monsters != ~std::uint64_t{}) {
+      // Line feeds and the like break the alignment of the groups with the bits of the masks
+      feed_monsters({data, block_size});
+      return;
+    }
+
+    // Monsters completing the group in progress, after which the complete groups start, and
+    // monsters starting the next group in progress, which are both tabulated with their groups
+    const std::size_t head = (group_size - monster_count_) % group_size;
+    const std::size_t tail = head + ((block_size - head) / group_size * group_size);
+    if (head != 0UZ) {
+      for (std::size_t i = 0UZ; i < head; ++i) {
+        group_ = (group_ * symbol_count) + symbol(data[i]);
+      }
+      potions_ += group_costs<group_size>()[group_];
+    }
+
+    const std::uint64_t complete = complete_masks[head];
+    potions_ += std::size_t(std::popcount(masks.b & complete)) +
+                (3UZ * std::size_t(std::popcount(masks.c & complete))) +
+                (5UZ * std::size_t(std::popcount(masks.d & complete)));
+
+    const std::uint64_t actual = ~masks.x;
+    std::size_t pair_count{};
+    for (std::size_t distance = 1UZ; distance < group_size; ++distance) {
+      pair_count += std::size_t(
+          std::popcount(actual & (actual >> distance) & pair_masks[head][distance - 1UZ]));
+    }
+    potions_ += 2UZ * pair_count;
+
+    monster_count_ = block_size - tail;
+    group_ = 0U;
+    for (std::size_t i = tail; i < block_size; ++i) {
+      group_ = (group_ * symbol_count) + symbol(data[i]);
+    }
+  }
+
+  // Bits of the complete groups of a block, by number of monsters before the first one
+  static constexpr auto complete_masks = [] {
+    std::array<std::uint64_t, group_size> result{};
+    for (std::size_t head = 0UZ; head < group_size; ++head) {
+      for (std::size_t i = head; i + group_size <= block_size; i += group_size) {
+        result[head] |= ((std::uint64_t{1} << (group_size - 1UZ) << 1U) - 1U) << i;
+      }
+    }
+    return result;
+  }();
+
+  // Bits of the first monsters of the pairs at the given distance in the complete groups of a
+  // block, by number of monsters before the first complete group
+  static constexpr auto pair_masks = [] {
+    std::array<std::array<std::uint64_t, group_size - 1UZ>, group_size> result{};
+    for (std::size_t head = 0UZ; head < group_size; ++head) {
+      for (std::size_t first = head; first + group_size <= block_size; first += group_size) {
+        for (std::size_t distance = 1UZ; distance < group_size; ++distance) {
+          for (std::size_t i = first; i + distance < first + group_size; ++i) {
+            result[head][distance - 1UZ] |= std::uint64_t{1} << i;
+          }
+        }
+      }
+    }
+    return result;
+  }();
+
+  std::size_t potions_{};
+  std::size_t monster_count_{};
+  // Table index of the group in progress
+  GroupIndex group_{};
+};
+
+// Potions for a stream of monsters in groups of any size, which are counted monster by monster, for
+// the groups too large to be tabulated
+class GenericPotionCounter {
+ public:
+  explicit GenericPotionCounter(const std::size_t group_size) : group_size_(group_size) {}
+
+  void feed(const std::string_view buffer) {
+    // The state is kept in locals, which the characters of the buffer cannot alias
+    std::size_t potions = potions_;
+    std::size_t monster_count = monster_count_;
+    std::size_t actual_monster_count = actual_monster_count_;
+    for (const char c : buffer) {
+      const Symbol monster = symbol(c);
+      if (monster == no_symbol) {
+        continue;
+      }
+      potions += symbol_potions[monster];
+      actual_monster_count += monster != empty_symbol ? 1UZ : 0UZ;
+      if (++monster_count == group_size_) {
+        potions += additional_potions(actual_monster_count);
+        monster_count = 0UZ;
+        actual_monster_count = 0UZ;
+      }
+    }
+    potions_ = potions;
+    monster_count_ = monster_count;
+    actual_monster_count_ = actual_monster_count;
+  }
+
+  // Potions for the monsters fed so far, the last group being possibly incomplete
+  auto total() const -> std::size_t { return potions_ + additional_potions(actual_monster_count_); }
+
+ private:
+  std::size_t group_size_;
+  std::size_t potions_{};
+  std::size_t monster_count_{};
+  std::size_t actual_monster_count_{};
+};
+
+// Size of the buffers of the log, which are read in turn by a single pass
+constexpr std::size_t buffer_size = std::size_t{1} << 16U;
+
+auto count_potions(auto counter, const std::string_view input) -> std::size_t {
+  for (std::size_t first = 0UZ; first < input.size(); first += buffer_size) {
+    counter.feed(input.substr(first, buffer_size));
+  }
+  return counter.total();
+}
+
+// Groups of up to `max_table_group_size` monsters are counted by their tables, the other ones by
+// monster
+auto solve(const std::string_view input, const std::size_t group_size) -> std::size_t {
+  static_assert(max_table_group_size == 8UZ);
+  switch (group_size) {
+    case 1UZ:
+      return count_potions(PotionCounter<1UZ>{}, input);
+    case 2UZ:
+      return count_potions(PotionCounter<2UZ>{}, input);
+    case 3UZ:
+      return count_potions(PotionCounter<3UZ>{}, input);
+    case 4UZ:
+      return count_potions(PotionCounter<4UZ>{}, input);
+    case 5UZ:
+      return count_potions(PotionCounter<5UZ>{}, input);
+    case 6UZ:
+      return count_potions(PotionCounter<6UZ>{}, input);
+    case 7UZ:
+      return count_potions(PotionCounter<7UZ>{}, input);
+    case 8UZ:
+      return count_potions(PotionCounter<8UZ>{}, input);
+    default:
+      return count_potions(GenericPotionCounter{group_size}, input);
+  }
+}
+
+// Former solving, on the monsters of the log copied into memory, and of every group copied again
+auto solve_reference(const std::string_view input, const std::size_t group_size) {
+  const auto monsters = input | std::views::filter([](const char c) { return isalpha(c); }) |
+                        std::ranges::to<std::vector>();
+  const std::size_t group_count = (monsters.size() + group_size - 1UZ) / group_size;
+  return common::parallel_reduce(
+      0UZ, group_count, 0UZ,
+      [&](const std::size_t rank) {
+        const auto group =
+            monsters | std::views::drop(rank * group_size) | std::views::take(group_size) |
+            std::ranges::to<std::vector>();
+        const auto actual_monster_count = group.size() - std::ranges::count(group, 'x');
+        return std::ranges::fold_left(std::views::transform(group, required_potions), 0UZ,
+                                      std::plus<>{}) +
+               additional_potions(actual_monster_count);
+      },
+      std::plus<>{});
+}
+
+auto solve_part1(const auto& input) { return solve(input, 1UZ); }
+
+auto solve_part2(const auto& input) { return solve(input, 2UZ); }
+
+auto solve_part3(const auto& input) { return solve(input, 3UZ); }
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+// The battle logs are also solved for the other group sizes, up to the first generic one
+constexpr std::size_t max_checked_group_size = max_table_group_size + 1UZ;
+
+auto group_size_variants() {
+  std::vector<common::Variant> result;
+  for (std::size_t group_size = 1UZ; group_size <= max_checked_group_size; ++group_size) {
+    result.push_back(common::make_variant<std::string_view>(
+        std::format("groups of {}", group_size),
+        [group_size](const auto& input) { return solve(input, group_size); },
+        [group_size](const auto& input) { return solve_reference(input, group_size); }));
+  }
+  return result;
+}
+
+auto make_part3() {
+  auto result = common::make_part(
+      {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+      [](const auto& input) { return solve_reference(input, 3UZ); });
+  result.variants = group_size_variants();
+  return result;
+}
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest01",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_reference(input, 1UZ); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_reference(input, 2UZ); }),
+        make_part3(),
+    },
+});
+
+}  // namespace
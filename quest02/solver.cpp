@@ -0,0 +1,341 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/aho_corasick.hpp"
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+#include "common/text.hpp"
+
+namespace {
+
+struct Input {
+  std::vector<std::string_view> words;
+  std::vector<std::string_view> sentences;
+};
+
+auto parse_input(const std::string_view input) {
+  auto lines = common::lines(input);
+  auto line_it = lines.begin();
+
+  const auto word_section = common::split_once(*line_it, ':').second;
+  auto words = common::fields<','>(word_section) | std::ranges::to<std::vector>();
+
+  auto sentences = std::ranges::subrange(std::next(line_it), lines.end()) |
+                   std::ranges::to<std::vector<std::string_view>>();
+
+  return Input{.words = std::move(words), .sentences = std::move(sentences)};
+}
+
+auto occurence_count(const std::span<const char> needle, const std::span<const char> haystack) {
+  std::size_t result{};
+
+  auto remainder = std::ranges::subrange(haystack.begin(), haystack.end());
+  for (;;) {
+    const auto found = std::ranges::search(remainder, needle);
+    if (found.begin() != found.end()) {
+      result += 1UZ;
+      remainder = std::ranges::subrange(std::next(found.begin()), remainder.end());
+    } else {
+      break;
+    }
+  }
+
+  return result;
+}
+
+auto tag_occurences(const std::ranges::range auto& needle, const std::ranges::range auto& haystack,
+                    std::ranges::range auto& tags) {
+  auto zip = std::views::zip(haystack, tags);
+  auto remainder = std::ranges::subrange(zip.begin(), zip.end());
+  for (;;) {
+    const auto found = std::ranges::search(remainder, needle, std::equal_to<>{},
+                                           [](const auto& pair) { return std::get<0>(pair); });
+    if (found.begin() != found.end()) {
+      for (auto entry : found) {
+        std::get<1>(entry) = true;
+      }
+      remainder = std::ranges::subrange(++found.begin(), remainder.end());
+    } else {
+      break;
+    }
+  }
+}
+
+auto reference_word_count(const auto& input) {
+  return std::ranges::fold_left(
+      std::views::transform(
+          input.sentences,
+          [&](const auto& sentence) {
+            return std::ranges::fold_left(
+                std::views::transform(
+                    input.words, [&](const auto& word) { return occurence_count(word, sentence); }),
+                0UZ, std::plus<>{});
+          }),
+      0UZ, std::plus<>{});
+}
+
+auto reference_rune_count(const auto& input) {
+  return std::ranges::fold_left(
+      std::views::transform(input.sentences,
+                            [&](const auto& sentence) {
+                              std::vector<bool> tags(sentence.size(), false);
+                              for (const auto& word : input.words) {
+                                tag_occurences(word, sentence, tags);
+                                tag_occurences(std::views::reverse(word), sentence, tags);
+                              }
+                              return std::ranges::count(tags, true);
+                            }),
+      0UZ, std::plus<>{});
+}
+
+auto reference_scale_count(const auto& input) {
+  std::vector<std::vector<bool>> tags(input.sentences.size(),
+                                      std::vector<bool>(input.sentences[0].size(), false));
+
+  for (const auto& word : input.words) {
+    const auto word_length = word.size();
+
+    for (auto [sentence, tag_row] : std::views::zip(input.sentences, tags)) {
+      std::array iotas{std::views::iota(0UZ, sentence.size()),
+                       std::views::iota(0UZ, word_length - 1UZ)};
+      auto haystack = std::views::join(iotas) |
+                      std::views::transform([&](const std::size_t j) { return sentence[j]; });
+      auto tag_range = std::views::join(iotas) |
+                       std::views::transform([&](const std::size_t j) { return tag_row[j]; });
+      tag_occurences(word, haystack, tag_range);
+      tag_occurences(std::views::reverse(word), haystack, tag_range);
+    }
+
+    for (const std::size_t j : std::views::iota(0UZ, input.sentences[0].size())) {
+      auto iota = std::views::iota(0UZ, input.sentences.size());
+      auto haystack =
+          iota | std::views::transform([&](const std::size_t i) { return input.sentences[i][j]; });
+      auto tag_range =
+          iota | std::views::transform([&](const std::size_t i) { return tags[i][j]; });
+      tag_occurences(word, haystack, tag_range);
+      tag_occurences(std::views::reverse(word), haystack, tag_range);
+    }
+  }
+
+  return std::ranges::count(std::views::join(tags), true);
+}
+
+// Automaton matching the runic words read in both directions
+auto bidirectional_matcher(const std::vector<std::string_view>& words) {
+  std::vector<std::string> patterns;
+  patterns.reserve(2UZ * words.size());
+  for (const std::string_view word : words) {
+    patterns.emplace_back(word);
+    patterns.push_back(std::views::reverse(word) | std::ranges::to<std::string>());
+  }
+  return common::AhoCorasick{patterns};
+}
+
+// Calls `visit(first, last)` with the bounds of the longest match ending at every character of
+// `text` where one does
+void for_each_longest_match(const common::AhoCorasick& matcher, const std::string_view text,
+                            const auto& visit) {
+  common::AhoCorasick::State state = common::AhoCorasick::root;
+  for (std::size_t k = 0UZ; k < text.size(); ++k) {
+    state = matcher.next(state, text[k]);
+    if (const std::size_t length = matcher.longest_match(state); length != 0UZ) {
+      visit(k + 1UZ - length, k + 1UZ);
+    }
+  }
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_word_count(input);
+  } else {
+    const common::AhoCorasick matcher{input.words};
+    std::size_t result{};
+    for (const std::string_view sentence : input.sentences) {
+      common::AhoCorasick::State state = common::AhoCorasick::root;
+      for (const char c : sentence) {
+        state = matcher.next(state, c);
+        result += matcher.match_count(state);
+      }
+    }
+    return result;
+  }
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_rune_count(input);
+  } else {
+    const auto matcher = bidirectional_matcher(input.words);
+    std::size_t result{};
+    for (const std::string_view sentence : input.sentences) {
+      std::vector<bool> tags(sentence.size(), false);
+      for_each_longest_match(matcher, sentence,
+                             [&](const std::size_t first, const std::size_t last) {
+                               std::fill(tags.begin() + std::ptrdiff_t(first),
+                                         tags.begin() + std::ptrdiff_t(last), true);
+                             });
+      result += std::size_t(std::ranges::count(tags, true));
+    }
+    return result;
+  }
+}
+
+// Scales of the armour, stored contiguously by row, every row being followed by its first scales
+// again so that the words wrapping around are read in one go, and by column
+struct Armour {
+  std::size_t row_count;
+  std::size_t col_count;
+  std::size_t row_stride;
+  std::vector<char> rows;
+  std::vector<char> columns;
+
+  Armour(const std::vector<std::string_view>& sentences, const std::size_t max_word_length)
+      : row_count(sentences.size()),
+        col_count(sentences.front().size()),
+        row_stride(col_count + max_word_length - 1UZ),
+        rows(row_count * row_stride),
+        columns(row_count * col_count) {
+    common::parallel_for(0UZ, row_count, [&](const std::size_t i) {
+      for (std::size_t k = 0UZ; k < row_stride; ++k) {
+        rows[(i * row_stride) + k] = sentences[i][k % col_count];
+      }
+    });
+    // By blocks of rows, so that the rows read stay in the cache while the columns are written
+    constexpr std::size_t block_size = 64UZ;
+    common::parallel_for(0UZ, (col_count + block_size - 1UZ) / block_size,
+                         [&](const std::size_t block) {
+                           const std::size_t last = std::min(col_count, (block + 1UZ) * block_size);
+                           for (std::size_t i = 0UZ; i < row_count; ++i) {
+                             for (std::size_t j = block * block_size; j < last; ++j) {
+                               columns[(j * row_count) + i] = sentences[i][j];
+                             }
+                           }
+                         });
+  }
+
+  auto row(const std::size_t i) const -> std::string_view {
+    return {rows.data() + (i * row_stride), row_stride};
+  }
+
+  auto column(const std::size_t j) const -> std::string_view {
+    return {columns.data() + (j * row_count), row_count};
+  }
+};
+
+// Tags of the scales as a row-major bitset, whose rows start on word boundaries, so that tasks
+// tagging distinct rows, or distinct words of columns, never write to the same word
+class TagPlane {
+ public:
+  using Word = std::uint64_t;
+  static constexpr std::size_t word_bits = 64UZ;
+
+  TagPlane(const std::size_t row_count, const std::size_t col_count)
+      : words_per_row_((col_count + word_bits - 1UZ) / word_bits),
+        words_(row_count * words_per_row_) {}
+
+  auto words_per_row() const { return words_per_row_; }
+
+  // Tags the scales [first, last) of a row
+  void tag_row(const std::size_t i, const std::size_t first, const std::size_t last) {
+    for (std::size_t j = first; j < last;) {
+      const std::size_t bit = j % word_bits;
+      const std::size_t count = std::min(last - j, word_bits - bit);
+      const Word mask = (count == word_bits ? ~Word{} : ((Word{1} << count) - 1U)) << bit;
+      words_[(i * words_per_row_) + (j / word_bits)] |= mask;
+      j += count;
+    }
+  }
+
+  void tag(const std::size_t i, const std::size_t j) {
+    words_[(i * words_per_row_) + (j / word_bits)] |= Word{1} << (j % word_bits);
+  }
+
+  auto count() const {
+    return common::parallel_reduce(
+        0UZ, words_.size(), 0UZ,
+        [this](const std::size_t rank) { return std::size_t(std::popcount(words_[rank])); },
+        std::plus<>{});
+  }
+
+ private:
+  std::size_t words_per_row_;
+  std::vector<Word> words_;
+};
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_scale_count(input);
+  } else {
+    if (input.words.empty()) {
+      return 0UZ;
+    }
+    const auto matcher = bidirectional_matcher(input.words);
+    const std::size_t max_word_length = std::ranges::max(std::views::transform(
+        input.words, [](const std::string_view word) { return word.size(); }));
+    const Armour armour{input.sentences, max_word_length};
+    TagPlane tags{armour.row_count, armour.col_count};
+
+    common::parallel_for(0UZ, armour.row_count, [&](const std::size_t i) {
+      for_each_longest_match(
+          matcher, armour.row(i), [&](std::size_t first, const std::size_t last) {
+            // Matches in the copy of the first scales wrap around
+            while (first < last) {
+              const std::size_t j = first % armour.col_count;
+              const std::size_t count = std::min(last - first, armour.col_count - j);
+              tags.tag_row(i, j, j + count);
+              first += count;
+            }
+          });
+    });
+
+    // The columns of a task make up whole words of the rows of the tags
+    common::parallel_for(0UZ, tags.words_per_row(), [&](const std::size_t word) {
+      const std::size_t last_column =
+          std::min(armour.col_count, (word + 1UZ) * TagPlane::word_bits);
+      for (std::size_t j = word * TagPlane::word_bits; j < last_column; ++j) {
+        for_each_longest_match(matcher, armour.column(j),
+                               [&](const std::size_t first, const std::size_t last) {
+                                 for (std::size_t i = first; i < last; ++i) {
+                                   tags.tag(i, j);
+                                 }
+                               });
+      }
+    });
+
+    return tags.count();
+  }
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest02",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/grid.hpp"
+#include "common/quest.hpp"
+
+namespace {
+
+using common::Loc;
+
+using Depth = std::uint16_t;
+using Grid = common::Grid<Depth>;
+
+auto parse_input(const std::string_view input) {
+  return Grid::from_text(input, Depth{}, [](const Loc& /*loc*/, const char c) {
+    return c == '#' ? Depth{1} : Depth{};
+  });
+}
+
+class Mine {
+ public:
+  explicit Mine(Grid depths) : depths_(std::move(depths)) {}
+
+  auto max_depth() const { return max_depth_; }
+
+  template <auto moves>
+  auto dig_one_layer() -> std::size_t {
+    const auto offsets = depths_.offsets(moves);
+    const std::vector<Grid::Index> candidates =
+        std::views::filter(depths_.indices(),
+                           [&](const Grid::Index index) {
+                             if (depths_[index] != max_depth()) {
+                               return false;
+                             }
+                             return std::ranges::all_of(offsets, [&](const Grid::Offset offset) {
+                               return depths_[index + offset] == max_depth_;
+                             });
+                           }) |
+        std::ranges::to<std::vector>();
+
+    if (!candidates.empty()) {
+      max_depth_ += Depth{1};
+      for (const Grid::Index index : candidates) {
+        depths_[index] = max_depth();
+      }
+    }
+
+    return candidates.size();
+  }
+
+  auto cumulative_depth() const -> std::size_t {
+    return std::ranges::fold_left(depths_.tiles(), 0UZ, std::plus<>{});
+  }
+
+  static constexpr std::array<Loc, 4> basic_moves{{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
+  static constexpr std::array<Loc, 8> advanced_moves{
+      {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}};
+
+ private:
+  Depth max_depth_{1};
+  Grid depths_;
+};
+
+// Digging layer after layer until no tile can be dug anymore
+template <auto moves>
+auto reference_cumulative_depth(const Grid& grid) {
+  Mine mine{grid};
+
+  while (mine.dig_one_layer<moves>() > 0) {
+    // Nothing to do
+  }
+
+  return mine.cumulative_depth();
+}
+
+// A tile ends up as deep as its distance to the nearest undug tile, so the depths are found at once
+// by a breadth-first search from the tiles next to the undug ones
+template <auto moves>
+auto cumulative_depth(const Grid& grid) {
+  const auto offsets = grid.offsets(moves);
+  std::vector<Depth> depths(grid.size(), Depth{});
+  std::vector<Grid::Index> front;
+  for (const Grid::Index index : grid.indices()) {
+    if (grid[index] != Depth{} && std::ranges::any_of(offsets, [&](const Grid::Offset offset) {
+          return grid[index + offset] == Depth{};
+        })) {
+      depths[index] = Depth{1};
+      front.push_back(index);
+    }
+  }
+
+  std::size_t result{};
+  std::vector<Grid::Index> next_front;
+  for (Depth depth{1}; !front.empty(); ++depth) {
+    result += front.size() * depth;
+    next_front.clear();
+    for (const Grid::Index index : front) {
+      for (const Grid::Offset offset : offsets) {
+        const Grid::Index next = index + offset;
+        if (grid[next] != Depth{} && depths[next] == Depth{}) {
+          depths[next] = Depth(depth + Depth{1});
+          next_front.push_back(next);
+        }
+      }
+    }
+    std::swap(front, next_front);
+  }
+
+  return result;
+}
+
+template <auto moves, common::Engine engine>
+auto solve(const Grid& grid) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_cumulative_depth<moves>(grid);
+  } else {
+    return cumulative_depth<moves>(grid);
+  }
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  return solve<Mine::basic_moves, engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return solve<Mine::basic_moves, engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  return solve<Mine::advanced_moves, engine>(input);
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest03",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
@@ -0,0 +1,61 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+#include "common/scan.hpp"
+
+namespace {
+
+using NailLength = std::uint64_t;
+
+auto parse_input(const std::string_view input) {
+  return common::scan_integers<NailLength>(input);
+}
+
+auto solve_part1(const auto& input) {
+  const NailLength base_length = *std::ranges::min_element(input);
+  return common::parallel_reduce(
+      0UZ, input.size(), NailLength{},
+      [&](const std::size_t rank) { return input[rank] - base_length; }, std::plus<>());
+}
+
+auto solve_part2(const auto& input) { return solve_part1(input); }
+
+auto solve_part3(const auto& input) {
+  const std::size_t nail_count = input.size();
+  auto nails = input;
+  const auto midpoint = std::next(nails.begin(), nail_count / 2);
+  std::ranges::nth_element(nails.begin(), midpoint, nails.end());
+  const NailLength target_length = *midpoint;
+
+  return common::parallel_reduce(
+      0UZ, nail_count, NailLength{},
+      [&](const std::size_t rank) {
+        const NailLength length = nails[rank];
+        return length < target_length ? target_length - length : length - target_length;
+      },
+      std::plus<>());
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest04",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
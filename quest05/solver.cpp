@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <set>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/checkpoint.hpp"
+#include "common/hash.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+#include "common/scan.hpp"
+
+namespace {
+
+using Number = std::uint16_t;
+using Shout = std::uint64_t;
+
+constexpr std::size_t column_count = 4UZ;
+
+auto multipler(Number n) {
+  Shout result{1};
+  do {  // NOLINT(cppcoreguidelines-avoid-do-while)
+    result *= Shout{10};
+    n /= Number{10};
+  } while (n > Number{});
+  return result;
+}
+
+struct Floor {
+  std::array<std::vector<Number>, column_count> columns;
+
+  auto operator<=>(const Floor&) const = default;
+
+  auto shout() const -> Shout {
+    return std::ranges::fold_left(columns, Shout{}, [](const auto& acc, const auto& column) {
+      const Number n = column.back();
+      return n + (acc * multipler(n));
+    });
+  }
+
+  auto dance(const std::size_t src_column_rank) {
+    auto& src_column = columns[src_column_rank];
+    const Number dancer_number = src_column.back();
+    src_column.pop_back();
+
+    auto& target_column = columns[(src_column_rank + 1UZ) % column_count];
+
+    const std::size_t step_count = (dancer_number - 1) % (2 * target_column.size());
+    const auto absorption_location =
+        std::ptrdiff_t(step_count <= target_column.size() ? (target_column.size() - step_count)
+                                                          : (step_count - target_column.size()));
+
+    target_column.insert(std::next(target_column.begin(), absorption_location), dancer_number);
+  }
+};
+
+auto parse_input(const std::string_view input) {
+  const auto values = common::scan_integers<Number>(input);
+
+  Floor result;
+
+  for (auto&& rng : std::views::reverse(values) | std::views::chunk(column_count)) {
+    for (auto&& [src, dst] : std::views::zip(rng, std::views::reverse(result.columns))) {
+      dst.push_back(src);
+    }
+  }
+
+  return result;
+}
+
+auto solve_part1(const auto& input) {
+  auto floor = input;
+
+  for (const auto round : std::views::iota(0UZ, 10UZ)) {
+    const auto src_column_rank = round % column_count;
+    floor.dance(src_column_rank);
+  }
+
+  return floor.shout();
+}
+
+auto solve_part2(const auto& input) {
+  auto floor = input;
+
+  std::unordered_map<Shout, std::size_t> counter;
+
+  for (const auto round : std::views::iota(0UZ)) {
+    const auto src_column_rank = round % column_count;
+    floor.dance(src_column_rank);
+    const auto shout = floor.shout();
+    if (++counter[shout] == 2024UZ) {
+      return shout * (round + 1UZ);
+    }
+  }
+
+  std::unreachable();
+}
+
+void write_floor(common::StateWriter& state, const Floor& floor) {
+  for (const auto& column : floor.columns) {
+    state.write(column);
+  }
+}
+
+auto read_floor(common::StateReader& state, Floor& floor) -> bool {
+  return std::ranges::all_of(floor.columns, [&](auto& column) { return state.read(column); });
+}
+
+// State of the search for a repeated floor, as saved in its checkpoints
+struct Search {
+  std::uint64_t next_round{};
+  Shout best_shout{};
+  Floor floor;
+  std::set<Floor> memory;
+
+  void write(common::StateWriter& state) const {
+    state.write(next_round);
+    state.write(best_shout);
+    write_floor(state, floor);
+    state.write(std::uint64_t(memory.size()));
+    for (const Floor& remembered : memory) {
+      write_floor(state, remembered);
+    }
+  }
+
+  auto read(common::StateReader& state) -> bool {
+    std::uint64_t memory_size{};
+    if (!state.read(next_round) || !state.read(best_shout) || !read_floor(state, floor) ||
+        !state.read(memory_size)) {
+      return false;
+    }
+    for (std::uint64_t i = 0U; i < memory_size; ++i) {
+      Floor remembered;
+      if (!read_floor(state, remembered)) {
+        return false;
+      }
+      memory.insert(memory.end(), std::move(remembered));
+    }
+    return state.done();
+  }
+};
+
+auto solve_part3(const auto& input) {
+  PROFILE_SCOPE("quest05 solve_part3");
+
+  common::StateWriter initial_state;
+  write_floor(initial_state, input);
+  common::Checkpoint checkpoint{"quest05_part3", common::hash_bytes(initial_state.bytes())};
+
+  Search search{.next_round = 0U, .best_shout = {}, .floor = input, .memory = {input}};
+  if (const auto saved = checkpoint.load()) {
+    Search resumed;
+    common::StateReader state{*saved};
+    if (resumed.read(state)) {
+      search = std::move(resumed);
+    }
+  }
+  auto& [next_round, result, floor, memory] = search;
+
+  for (const auto round : std::views::iota(std::size_t(next_round))) {
+    PROFILE_COUNT("quest05 rounds", 1);
+    const auto src_column_rank = round % column_count;
+    floor.dance(src_column_rank);
+    result = std::max(floor.shout(), result);
+    if (src_column_rank == (column_count - 1UZ) && !memory.insert(floor).second) {
+      checkpoint.remove();
+      return result;
+    }
+    if (checkpoint.due()) {
+      next_round = round + 1UZ;
+      common::StateWriter state;
+      search.write(state);
+      checkpoint.save(state);
+    }
+  }
+
+  std::unreachable();
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest05",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
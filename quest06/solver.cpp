@@ -1,61 +1,47 @@
 #include <algorithm>
 #include <cstddef>
-#include <fstream>
-#include <ios>
-#include <istream>
 #include <iterator>
 #include <map>
-#include <print>
 #include <ranges>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include "common/quest.hpp"
+#include "common/text.hpp"
+
+namespace {
+
 using namespace std::string_view_literals;
 
 struct Branch {
-  std::vector<std::string> children;
+  std::vector<std::string_view> children;
   std::size_t fruit_count{};
 };
 
 struct Tree {
-  std::map<std::string, Branch, std::less<>> branches;
+  std::map<std::string_view, Branch, std::less<>> branches;
 
   auto fruit_paths() const -> std::vector<std::vector<std::string_view>>;
 };
 
-auto parse_input(std::istream&& in) {
+auto parse_input(const std::string_view input) {
   Tree result;
 
-  auto branches = std::views::istream<char>(in >> std::noskipws) | std::views::lazy_split('\n') |
-                  std::views::filter([](const auto& rng) { return rng.begin() != rng.end(); }) |
-                  std::views::transform([](const auto& rng) {
-                    auto sections = rng | std::views::lazy_split(':');
-
-                    auto section_it = sections.begin();
-                    auto name = *section_it | std::ranges::to<std::string>();
-
-                    ++section_it;
-                    auto children = *section_it | std::views::lazy_split(',') |
-                                    std::views::transform([](const auto& rng) {
-                                      return rng | std::ranges::to<std::string>();
-                                    });
-
-                    Branch branch;
-                    for (std::string&& token : children) {
-                      if (token == "@") {
-                        branch.fruit_count += 1UZ;
-                      } else {
-                        branch.children.push_back(std::move(token));
-                      }
-                    }
-
-                    return std::pair<std::string, Branch>{std::move(name), std::move(branch)};
-                  });
-
-  for (auto&& [name, branch] : branches) {
-    result.branches.emplace(std::move(name), std::move(branch));
+  for (const std::string_view line : common::lines(input)) {
+    const auto [name, children] = common::split_once(line, ':');
+
+    Branch branch;
+    for (const std::string_view token : common::fields<','>(children)) {
+      if (token == "@"sv) {
+        branch.fruit_count += 1UZ;
+      } else {
+        branch.children.push_back(token);
+      }
+    }
+
+    result.branches.emplace(name, std::move(branch));
   }
 
   return result;
@@ -132,16 +118,18 @@ auto solve_part3(const auto& input) {
          std::ranges::to<std::string>();
 }
 
-auto main() -> int {
-  const auto input1 = parse_input(std::ifstream{"input1.txt"});
-  const auto answer1 = solve_part1(input1);
-  std::println("The answer to part #1 is {}", answer1);
-
-  const auto input2 = parse_input(std::ifstream{"input2.txt"});
-  const auto answer2 = solve_part2(input2);
-  std::println("The answer to part #2 is {}", answer2);
-
-  const auto input3 = parse_input(std::ifstream{"input3.txt"});
-  const auto answer3 = solve_part3(input3);
-  std::println("The answer to part #3 is {}", answer3);
-}
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest06",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
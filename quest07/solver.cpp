@@ -2,18 +2,23 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <functional>
-#include <ios>
-#include <istream>
 #include <map>
 #include <optional>
-#include <print>
 #include <ranges>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "common/checkpoint.hpp"
+#include "common/hash.hpp"
+#include "common/quest.hpp"
+#include "common/resident.hpp"
+#include "common/text.hpp"
+
+namespace {
+
 enum class Instruction : std::uint8_t {
   increase,
   decrease,
@@ -39,27 +44,17 @@ using PlanId = char;
 
 using Plan = std::vector<Instruction>;
 
-auto parse_input(std::istream&& in) {
-  auto plans = std::views::istream<char>(in >> std::noskipws) | std::views::lazy_split('\n') |
-               std::views::filter([](const auto& rng) { return rng.begin() != rng.end(); }) |
-               std::views::transform([](const auto& rng) {
-                 auto sections = rng | std::views::lazy_split(':');
-
-                 auto section_it = sections.begin();
-                 const PlanId plan_id = *(*section_it).begin();
-
-                 ++section_it;
-                 auto plan = std::views::lazy_split(*section_it, ',') |
-                             std::views::transform([](const auto& rng) {
-                               return *instruction_from_char(*rng.begin());
-                             }) |
-                             std::ranges::to<std::vector>();
-                 return std::pair<PlanId, Plan>{plan_id, std::move(plan)};
-               });
+auto parse_input(const std::string_view input) {
+  const auto instruction = [](const std::string_view action) {
+    return *instruction_from_char(action.front());
+  };
 
   std::map<PlanId, Plan> result;
-  for (auto&& [plan_id, plan] : plans) {
-    result.emplace(plan_id, std::move(plan));
+  for (const std::string_view line : common::lines(input)) {
+    const auto [plan_id, actions] = common::split_once(line, ':');
+    result.emplace(plan_id.front(), common::fields<','>(actions) |
+                                        std::views::transform(instruction) |
+                                        std::ranges::to<std::vector>());
   }
   return result;
 }
@@ -126,15 +121,12 @@ struct TrackData {
   }
 };
 
-auto parse_track(std::istream&& in) {
-  const TrackData data{
-      std::views::istream<char>(in >> std::noskipws) | std::views::lazy_split('\n') |
-      std::views::filter([](const auto& rng) { return rng.begin() != rng.end(); }) |
-      std::views::transform([](const auto& rng) {
-        return rng | std::views::transform([](const char c) { return instruction_from_char(c); }) |
-               std::ranges::to<std::vector>();
-      }) |
-      std::ranges::to<std::vector>()};
+auto parse_track(const std::string_view input) {
+  const TrackData data{common::lines(input) | std::views::transform([](const std::string_view row) {
+                         return row | std::views::transform(instruction_from_char) |
+                                std::ranges::to<std::vector>();
+                       }) |
+                       std::ranges::to<std::vector>()};
 
   Track result;
 
@@ -157,7 +149,7 @@ auto actual_instruction(const Instruction tile, const Instruction instruction) {
   return tile == Instruction::maintain ? instruction : tile;
 }
 
-auto collected_energy(const Track& track, const Plan& plan, const std::size_t loops) {
+auto reference_collected_energy(const Track& track, const Plan& plan, const std::size_t loops) {
   auto tiles = std::views::join(std::views::repeat(std::views::all(track), loops));
   auto instructions = std::views::join(std::views::repeat(std::views::all(plan)));
   auto steps = std::views::zip(tiles, instructions);
@@ -173,11 +165,39 @@ auto collected_energy(const Track& track, const Plan& plan, const std::size_t lo
       .second;
 }
 
+// Same as `reference_collected_energy`, with plain indices instead of nested views
+auto collected_energy(const Track& track, const Plan& plan, const std::size_t loops) {
+  Energy current{10};
+  Energy result{};
+  std::size_t instruction_rank{};
+  for (std::size_t loop{}; loop < loops; ++loop) {
+    for (const Instruction tile : track) {
+      current = current + actual_instruction(tile, plan[instruction_rank]);
+      result += current;
+      if (++instruction_rank == plan.size()) {
+        instruction_rank = 0UZ;
+      }
+    }
+  }
+  return result;
+}
+
+template <common::Engine engine>
+auto collected_energy(const Track& track, const Plan& plan, const std::size_t loops) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_collected_energy(track, plan, loops);
+  } else {
+    return collected_energy(track, plan, loops);
+  }
+}
+
+template <common::Engine engine = common::Engine::optimized>
 auto solve_part2(const auto& input, const auto& track) {
   auto v = std::views::transform(input,
                                  [&](const auto& entry) {
                                    const auto& [plan_id, plan] = entry;
-                                   return std::pair{plan_id, collected_energy(track, plan, 10)};
+                                   return std::pair{plan_id,
+                                                    collected_energy<engine>(track, plan, 10)};
                                  }) |
            std::ranges::to<std::vector>();
 
@@ -187,8 +207,9 @@ auto solve_part2(const auto& input, const auto& track) {
          std::ranges::to<std::string>();
 }
 
+template <common::Engine engine = common::Engine::optimized>
 auto solve_part3(const auto& input, const auto& track) {
-  const Energy threshold = collected_energy(track, input.begin()->second, 11);
+  const Energy threshold = collected_energy<engine>(track, input.begin()->second, 11);
 
   Plan plan{
       Instruction::increase, Instruction::increase, Instruction::increase, Instruction::increase,
@@ -196,28 +217,67 @@ auto solve_part3(const auto& input, const auto& track) {
       Instruction::maintain, Instruction::maintain, Instruction::maintain,
   };
 
-  std::size_t result{};
+  common::StateWriter initial_state;
+  initial_state.write(track);
+  initial_state.write(input.begin()->second);
+  common::Checkpoint checkpoint{"quest07_part3", common::hash_bytes(initial_state.bytes())};
+
+  // The checkpoints hold the next permutation to try and the count of the previous ones
+  std::uint64_t result{};
+  if (const auto saved = checkpoint.load()) {
+    common::StateReader state{*saved};
+    Plan resumed_plan;
+    std::uint64_t resumed_result{};
+    if (state.read(resumed_plan) && state.read(resumed_result) && state.done() &&
+        std::ranges::is_permutation(resumed_plan, plan)) {
+      plan = std::move(resumed_plan);
+      result = resumed_result;
+    }
+  }
+
   do {  // NOLINT(cppcoreguidelines-avoid-do-while)
-    if (collected_energy(track, plan, 11) > threshold) {
+    if (checkpoint.due()) {
+      common::StateWriter state;
+      state.write(plan);
+      state.write(result);
+      checkpoint.save(state);
+    }
+    if (collected_energy<engine>(track, plan, 11) > threshold) {
       ++result;
     }
   } while (std::ranges::next_permutation(plan).found);
 
+  checkpoint.remove();
   return result;
 }
 
-auto main() -> int {
-  const auto input1 = parse_input(std::ifstream{"input1.txt"});
-  const auto answer1 = solve_part1(input1);
-  std::println("The answer to part #1 is {}", answer1);
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
 
-  const auto input2 = parse_input(std::ifstream{"input2.txt"});
-  const auto track2 = parse_track(std::ifstream{"track2.txt"});
-  const auto answer2 = solve_part2(input2, track2);
-  std::println("The answer to part #2 is {}", answer2);
-
-  const auto input3 = parse_input(std::ifstream{"input3.txt"});
-  const auto track3 = parse_track(std::ifstream{"track3.txt"});
-  const auto answer3 = solve_part3(input3, track3);
-  std::println("The answer to part #3 is {}", answer3);
+// The track stays resident in a long-running process, as every plan is raced on the same one
+auto parse_with_track(const common::Sources sources) {
+  return std::pair{parse_input(sources[0]),
+                   common::resident_store().get<Track>(common::hash_bytes(sources[1]),
+                                                       [&] { return parse_track(sources[1]); })};
 }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest07",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part(
+            {"input2.txt", "track2.txt"}, parse_with_track,
+            [](const auto& input) { return solve_part2(input.first, *input.second); },
+            [](const auto& input) {
+              return solve_part2<common::Engine::reference>(input.first, *input.second);
+            }),
+        common::make_part(
+            {"input3.txt", "track3.txt"}, parse_with_track,
+            [](const auto& input) { return solve_part3(input.first, *input.second); },
+            [](const auto& input) {
+              return solve_part3<common::Engine::reference>(input.first, *input.second);
+            }),
+    },
+});
+
+}  // namespace
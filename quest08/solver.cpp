@@ -1,19 +1,20 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <fstream>
-#include <istream>
 #include <iterator>
 #include <numeric>
-#include <print>
 #include <ranges>
+#include <string_view>
 #include <utility>
 #include <vector>
 
-auto parse_input(std::istream&& in) {
-  std::size_t result;  // NOLINT(cppcoreguidelines-init-variables)
-  in >> result;
-  return result;
+#include "common/quest.hpp"
+#include "common/scan.hpp"
+
+namespace {
+
+auto parse_input(const std::string_view input) {
+  return common::scan_integers<std::size_t>(input).front();
 }
 
 auto solve_part1(const auto& input) {
@@ -95,16 +96,18 @@ auto solve_part3(const auto& input) {
   std::unreachable();
 }
 
-auto main() -> int {
-  const auto input1 = parse_input(std::ifstream{"input1.txt"});
-  const auto answer1 = solve_part1(input1);
-  std::println("The answer to part #1 is {}", answer1);
-
-  const auto input2 = parse_input(std::ifstream{"input2.txt"});
-  const auto answer2 = solve_part2(input2);
-  std::println("The answer to part #2 is {}", answer2);
-
-  const auto input3 = parse_input(std::ifstream{"input3.txt"});
-  const auto answer3 = solve_part3(input3);
-  std::println("The answer to part #3 is {}", answer3);
-}
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest08",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "common/hash.hpp"
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+#include "common/resident.hpp"
+#include "common/scan.hpp"
+
+namespace {
+
+using Brightness = std::uint32_t;
+
+auto parse_input(const std::string_view input) {
+  return common::scan_integers<Brightness>(input);
+}
+
+auto solve_part1(const auto& input) {
+  constexpr std::array<Brightness, 4> stamps{{1, 3, 5, 10}};
+
+  return std::ranges::fold_left(
+      std::views::transform(input,
+                            [&](Brightness brightness) {
+                              std::size_t result{};
+
+                              for (const auto stamp : std::views::reverse(stamps)) {
+                                const std::size_t count = brightness / stamp;
+                                brightness -= (count * stamp);
+                                result += count;
+                              }
+
+                              return result;
+                            }),
+      std::size_t{}, std::plus<>{});
+}
+
+auto memoize(const std::span<const Brightness> stamps, const Brightness upper_bound) {
+  std::vector<std::size_t> result;
+  result.reserve(upper_bound + Brightness{1});
+
+  result.emplace_back();
+  for (const auto brightness : std::views::iota(Brightness{1}, upper_bound + Brightness{1})) {
+    result.emplace_back(std::ranges::min(
+        std::views::filter(stamps, [&](const Brightness stamp) { return stamp <= brightness; }) |
+        std::views::transform(
+            [&](const Brightness stamp) { return result[brightness - stamp] + 1UZ; })));
+  }
+
+  return result;
+}
+
+// Memo of the stamps, which stays resident in a long-running process and is only recomputed for a
+// brightness above the ones it covers
+auto resident_memo(const std::span<const Brightness> stamps, const Brightness upper_bound)
+    -> std::shared_ptr<const std::vector<std::size_t>> {
+  const std::string_view stamp_bytes{reinterpret_cast<const char*>(stamps.data()),
+                                     stamps.size_bytes()};
+  return common::resident_store().get<std::vector<std::size_t>>(
+      common::hash_bytes(stamp_bytes), [&] { return memoize(stamps, upper_bound); },
+      [&](const std::vector<std::size_t>& memo) { return memo.size() > upper_bound; });
+}
+
+auto solve_part2(const auto& input) {
+  constexpr std::array<Brightness, 10> stamps{{1, 3, 5, 10, 15, 16, 20, 24, 25, 30}};
+
+  const std::size_t upper_bound = *std::ranges::max_element(input);
+  const auto memo = resident_memo(stamps, upper_bound);
+  const std::vector<std::size_t>& memory = *memo;
+
+  return std::ranges::fold_left(
+      std::views::transform(input, [&](Brightness brightness) { return memory[brightness]; }),
+      std::size_t{}, std::plus<>{});
+}
+
+// Every term of part 3 scans 50 imbalances, so that a few sparkballs are worth a task
+constexpr std::size_t min_chunk_size = 16UZ;
+
+auto solve_part3(const auto& input) {
+  constexpr std::array<Brightness, 18> stamps{
+      {1, 3, 5, 10, 15, 16, 20, 24, 25, 30, 37, 38, 49, 50, 74, 75, 100, 101}};
+  constexpr Brightness max_delta = 100;
+
+  const std::size_t upper_bound =
+      (*std::ranges::max_element(input) + max_delta + Brightness{1}) / Brightness{2};
+
+  const auto memo = resident_memo(stamps, upper_bound);
+  const std::vector<std::size_t>& memory = *memo;
+
+  return common::parallel_reduce(
+      0UZ, input.size(), std::size_t{},
+      [&](const std::size_t rank) {
+        const Brightness brightness = input[rank];
+        const Brightness low_brightness = brightness / Brightness{2};
+        const Brightness high_brightness = brightness - low_brightness;
+        const bool brightness_is_even = low_brightness == high_brightness;
+        const Brightness upper_bound = brightness_is_even ? Brightness{50} : Brightness{49};
+
+        return std::ranges::min(std::views::iota(Brightness{}, upper_bound + Brightness{1}) |
+                                std::views::transform([&](const Brightness imbalance) {
+                                  return memory[low_brightness - imbalance] +
+                                         memory[high_brightness + imbalance];
+                                }));
+      },
+      std::plus<>{}, min_chunk_size);
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest09",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
@@ -1,28 +1,26 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
-#include <fstream>
 #include <functional>
-#include <ios>
-#include <istream>
-#include <print>
 #include <ranges>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "common/quest.hpp"
+#include "common/text.hpp"
+
+namespace {
+
 struct Engraving {
   std::array<std::array<char, 4>, 4> col_symbols;
   std::array<std::array<char, 4>, 4> row_symbols;
 };
 
-auto parse_input(std::istream&& in) {
-  const auto data = std::views::istream<char>(in >> std::noskipws) | std::ranges::to<std::vector>();
-
+auto parse_input(const std::string_view input) {
   std::vector<Engraving> result;  // NOLINT(cppcoreguidelines-pro-type-member-init)
 
-  auto lines = std::views::split(data, '\n') |
-               std::views::filter([](const auto& rng) { return !rng.empty(); });
+  const auto lines = common::lines(input);
 
   auto all_rows =
       std::views::iota(0, 8) | std::views::transform([&lines](const auto rank) {
@@ -110,16 +108,18 @@ auto solve_part2(const auto& input) {
 
 auto solve_part3(const auto& input) { return 0; }
 
-auto main() -> int {
-  const auto input1 = parse_input(std::ifstream{"input1.txt"});
-  const auto answer1 = solve_part1(input1);
-  std::println("The answer to part #1 is {}", answer1);
-
-  const auto input2 = parse_input(std::ifstream{"input2.txt"});
-  const auto answer2 = solve_part2(input2);
-  std::println("The answer to part #2 is {}", answer2);
-
-  const auto input3 = parse_input(std::ifstream{"input3.txt"});
-  const auto answer3 = solve_part3(input3);
-  std::println("The answer to part #3 is {}", answer3);
-}
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest10",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
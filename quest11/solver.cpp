@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/arena.hpp"
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+#include "common/text.hpp"
+
+namespace {
+
+using Category = std::string_view;
+using LifeCycle = std::map<Category, std::vector<Category>>;
+
+auto parse_input(const std::string_view input) {
+  LifeCycle result;
+
+  for (const std::string_view line : common::lines(input)) {
+    const auto [parent, children] = common::split_once(line, ':');
+    result.emplace(parent,
+                   common::fields<','>(children) | std::ranges::to<std::vector<Category>>());
+  }
+
+  return result;
+}
+
+using Population = std::pmr::map<Category, std::size_t>;
+
+auto breed(const LifeCycle& life_cycle, const Population& current) -> Population {
+  Population result{current.get_allocator()};
+  for (const auto& [parent, count] : current) {
+    const auto& children = life_cycle.find(parent)->second;
+    for (const auto& child : children) {
+      result[child] += count;
+    }
+  }
+  return result;
+}
+
+template <common::Engine engine>
+auto population_count(const LifeCycle& life_cycle, const Category& ancestor,
+                      const std::size_t cycles) -> std::size_t {
+  // The nodes of the population of a cycle are recycled by those of the next ones, so that the
+  // memory stays bounded by two populations, while the reference allocates them from the heap, as
+  // the first implementation
+  common::Arena arena;
+  Population population{{{ancestor, 1UZ}},
+                        engine == common::Engine::reference
+                            ? std::pmr::new_delete_resource()
+                            : static_cast<std::pmr::memory_resource*>(&arena)};
+  for (auto _ : std::views::iota(0UZ, cycles)) {
+    population = breed(life_cycle, population);
+  }
+  return std::ranges::fold_left(std::views::values(population), std::size_t{}, std::plus<>{});
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  return population_count<engine>(input, "A", 4UZ);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return population_count<engine>(input, "Z", 10UZ);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  if constexpr (engine == common::Engine::reference) {
+    const auto [min, max] = std::ranges::minmax(
+        std::views::keys(input) | std::views::transform([&input](const Category& category) {
+          return population_count<engine>(input, category, 20UZ);
+        }));
+    return max - min;
+  } else {
+    const auto categories = std::views::keys(input) | std::ranges::to<std::vector>();
+    std::vector<std::size_t> counts(categories.size());
+    common::parallel_for(0UZ, categories.size(), [&](const std::size_t rank) {
+      counts[rank] = population_count<engine>(input, categories[rank], 20UZ);
+    });
+    const auto [min, max] = std::ranges::minmax(counts);
+    return max - min;
+  }
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest11",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
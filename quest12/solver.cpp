@@ -1,18 +1,24 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <fstream>
 #include <functional>
-#include <ios>
-#include <istream>
 #include <iterator>
-#include <print>
 #include <ranges>
+#include <string_view>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "common/line_chunks.hpp"
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+#include "common/scan.hpp"
+#include "common/text.hpp"
+
+namespace {
+
 using Coord = std::int32_t;
 using Loc = std::array<Coord, 2>;
 
@@ -35,34 +41,21 @@ auto hardness(char tile) -> Hardness {
   return {};
 }
 
-auto parse_input(std::istream&& in) {
-  const auto data = std::views::istream<char>(in >> std::noskipws) | std::ranges::to<std::vector>();
-
-  auto lines = std::views::split(data, '\n') |
-               std::views::filter([](const auto& line) { return !line.empty(); });
-
-  const auto line_count = std::ranges::distance(lines.begin(), lines.end());
-
-  const auto first_line_coord = Coord(line_count - 2);
-
-  auto rows = std::views::enumerate(lines) | std::views::transform([&](const auto& pair) {
-                std::tuple result = pair;
-                std::get<0>(result) = first_line_coord - std::get<0>(pair);
-                return result;
-              });
-
-  auto targets =
-      std::views::join(rows | std::views::transform([](const auto& row_pair) {
-                         const auto& [y, row] = row_pair;
-                         return std::views::enumerate(row) |
-                                std::views::transform([y](const auto& col_pair) {
-                                  const auto& [x, tile] = col_pair;
-                                  return Target{{Coord(x - 1), Coord(y)}, hardness(tile)};
-                                });
-                       })) |
-      std::views::filter([](const Target& target) { return target.hardness != Hardness{}; });
-
-  return targets | std::ranges::to<std::vector>();
+auto parse_input(const std::string_view input) {
+  const auto chunks = common::split_lines(input);
+
+  const auto first_line_coord = Coord(chunks.row_count) - 2;
+
+  return common::parallel_collect_lines<Target>(
+      chunks,
+      [&](const std::size_t row, const std::string_view line, std::vector<Target>& targets) {
+        const Coord y = first_line_coord - Coord(row);
+        for (const auto [x, tile] : std::views::enumerate(line)) {
+          if (const Hardness target_hardness = hardness(tile); target_hardness != Hardness{}) {
+            targets.push_back({{Coord(x - 1), y}, target_hardness});
+          }
+        }
+      });
 }
 
 enum class Segment : std::uint8_t {
@@ -100,8 +93,8 @@ auto solve_part1(const auto& input) {
 
 auto solve_part2(const auto& input) { return solve_part1(input); }
 
-auto parse_input3(std::istream&& in) {
-  return std::views::istream<Coord>(in) | std::views::chunk(2) |
+auto parse_input3(const std::string_view input) {
+  return common::scan_integers<Coord>(input) | std::views::chunk(2) |
          std::views::transform([](const auto& pair) {
            Loc result;
            std::ranges::copy(pair, result.begin());
@@ -139,24 +132,26 @@ auto moving_target_solution_ranking(const Loc& target) -> Ranking {
 }
 
 auto solve_part3(const auto& input) {
-  return std::ranges::fold_left(
-      std::views::transform(input,
-                            [](const Loc& initial_location) {
-                              return moving_target_solution_ranking(initial_location);
-                            }),
-      Ranking{}, std::plus<>{});
+  return common::parallel_reduce(
+      0UZ, input.size(), Ranking{},
+      [&](const std::size_t rank) { return moving_target_solution_ranking(input[rank]); },
+      std::plus<>{});
 }
 
-auto main() -> int {
-  const auto input1 = parse_input(std::ifstream{"input1.txt"});
-  const auto answer1 = solve_part1(input1);
-  std::println("The answer to part #1 is {}", answer1);
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
 
-  const auto input2 = parse_input(std::ifstream{"input2.txt"});
-  const auto answer2 = solve_part2(input2);
-  std::println("The answer to part #2 is {}", answer2);
+auto parse3(const common::Sources sources) { return parse_input3(sources.front()); }
 
-  const auto input3 = parse_input3(std::ifstream{"input3.txt"});
-  const auto answer3 = solve_part3(input3);
-  std::println("The answer to part #3 is {}", answer3);
-}
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest12",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part({"input2.txt"}, parse,
+                          [](const auto& input) { return solve_part2(input); }),
+        common::make_part({"input3.txt"}, parse3,
+                          [](const auto& input) { return solve_part3(input); }),
+    },
+});
+
+}  // namespace
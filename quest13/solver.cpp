@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <ranges>
+#include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/grid.hpp"
+#include "common/line_chunks.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+
+namespace {
+
+using common::Coord;
+using common::Loc;
+
+using Level = std::uint8_t;
+using Grid = common::Grid<Level>;
+
+constexpr Level no_platform = std::numeric_limits<Level>::max();
+
+struct Maze {  // NOLINT(cppcoreguidelines-pro-type-member-init)
+  Grid platforms;
+  std::vector<Loc> starts;
+  Loc exit;
+};
+
+auto parse_input(const std::string_view input) {
+  Maze result;
+
+  const auto chunks = common::split_lines(input);
+
+  result.platforms = Grid::from_chunks(chunks, no_platform, [](const Loc& /*loc*/, const char c) {
+    if (std::isdigit(c) != 0) {
+      return Level(c - '0');
+    }
+    if (c == 'S' || c == 'E') {
+      return Level{};
+    }
+    return no_platform;
+  });
+
+  // The few start and exit tiles are gathered in a second pass
+  using Mark = std::pair<Loc, char>;
+  const auto marks = common::parallel_collect_lines<Mark>(
+      chunks, [](const std::size_t row, const std::string_view line, std::vector<Mark>& marks) {
+        for (std::size_t col = line.find_first_of("SE"); col != std::string_view::npos;
+             col = line.find_first_of("SE", col + 1UZ)) {
+          marks.emplace_back(Loc{Coord(row), Coord(col)}, line[col]);
+        }
+      });
+  for (const auto& [loc, c] : marks) {
+    if (c == 'S') {
+      result.starts.push_back(loc);
+    } else {
+      result.exit = loc;
+    }
+  }
+
+  return result;
+}
+
+constexpr std::array<Loc, 4> moves{{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
+
+auto shortest_path(const Maze& maze) -> std::size_t {
+  PROFILE_SCOPE("quest13 shortest_path");
+
+  const Grid& platforms = maze.platforms;
+
+  using Candidate = std::pair<std::size_t, Grid::Index>;
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> queue;
+  for (const Loc& start : maze.starts) {
+    queue.emplace(0UZ, platforms.index(start));
+  }
+
+  const Grid::Index exit = platforms.index(maze.exit);
+  const auto offsets = platforms.offsets(moves);
+  std::vector<bool> explored(platforms.size(), false);
+
+  while (!queue.empty()) {
+    const auto [length, index] = queue.top();
+    queue.pop();
+    PROFILE_COUNT("quest13 nodes popped", 1);
+
+    if (index == exit) {
+      return length;
+    }
+
+    if (!explored[index]) {
+      explored[index] = true;
+      const auto current_level = platforms[index];
+      for (const Grid::Offset offset : offsets) {
+        const Grid::Index next = index + offset;
+        const auto next_level = platforms[next];
+        if (!explored[next] && next_level != no_platform) {
+          const std::size_t delta =
+              std::max(current_level, next_level) - std::min(current_level, next_level);
+          const std::size_t distance = std::min(delta, 10UZ - delta);
+          queue.emplace(length + distance + 1UZ, next);
+        }
+      }
+    }
+  }
+
+  return std::numeric_limits<std::size_t>::max();
+}
+
+auto operator+(const Loc& a, const Loc& b) -> Loc { return {a[0] + b[0], a[1] + b[1]}; }
+
+// Former search, over a map of the platforms and a set of the explored ones, ordered by location
+auto reference_shortest_path(const Maze& maze) -> std::size_t {
+  std::map<Loc, Level> platforms;
+  for (const Grid::Index index : maze.platforms.indices()) {
+    if (maze.platforms[index] != no_platform) {
+      platforms.emplace(maze.platforms.loc(index), maze.platforms[index]);
+    }
+  }
+
+  using Candidate = std::pair<std::size_t, Loc>;
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> queue;
+  for (const Loc& start : maze.starts) {
+    queue.emplace(0UZ, start);
+  }
+
+  std::set<Loc> explored;
+
+  while (!queue.empty()) {
+    const auto [length, loc] = queue.top();
+    queue.pop();
+
+    if (loc == maze.exit) {
+      return length;
+    }
+
+    if (explored.insert(loc).second) {
+      const auto current_level = platforms.find(loc)->second;
+      for (const Loc& move : moves) {
+        const Loc next = loc + move;
+        if (!explored.contains(next)) {
+          const auto next_it = platforms.find(next);
+          if (next_it != platforms.end()) {
+            const auto next_level = next_it->second;
+            const std::size_t delta =
+                std::max(current_level, next_level) - std::min(current_level, next_level);
+            const std::size_t distance = std::min(delta, 10UZ - delta);
+            queue.emplace(length + distance + 1UZ, next);
+          }
+        }
+      }
+    }
+  }
+
+  return std::numeric_limits<std::size_t>::max();
+}
+
+template <common::Engine engine>
+auto solve(const Maze& maze) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_shortest_path(maze);
+  } else {
+    return shortest_path(maze);
+  }
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  return solve<engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return solve<engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  return solve<engine>(input);
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest13",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
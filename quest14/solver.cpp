@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ranges>
+#include <set>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/coord_set.hpp"
+#include "common/parallel.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+#include "common/text.hpp"
+
+namespace {
+
+enum class Direction : std::uint8_t { u, d, l, r, f, b };
+
+constexpr std::array<Direction, 6> all_directions{
+    Direction::u, Direction::d, Direction::l, Direction::r, Direction::f, Direction::b,
+};
+
+auto parse_direction(const char c) -> Direction {
+  switch (c) {
+    case 'U':
+      return Direction::u;
+    case 'D':
+      return Direction::d;
+    case 'L':
+      return Direction::l;
+    case 'R':
+      return Direction::r;
+    case 'F':
+      return Direction::f;
+    case 'B':
+      return Direction::b;
+    default:
+      break;
+  }
+  std::unreachable();
+}
+
+using Length = std::int32_t;
+
+struct Growth {
+  Direction direction;
+  Length length;
+};
+
+auto parse_growth(const std::string_view token) -> Growth {
+  return {.direction = parse_direction(token.front()),
+          .length = common::to_number<Length>(token.substr(1UZ))};
+}
+
+auto parse_input(const std::string_view input) {
+  return common::lines(input) | std::views::transform([](const std::string_view line) {
+           return common::fields<','>(line) | std::views::transform(parse_growth) |
+                  std::ranges::to<std::vector>();
+         }) |
+         std::ranges::to<std::vector>();
+}
+
+using Coord = std::int64_t;
+
+auto vertical_growth(const Growth& growth) -> Coord {
+  switch (growth.direction) {
+    case Direction::u:
+      return growth.length;
+    case Direction::d:
+      return -growth.length;
+    default:
+      break;
+  }
+  return {};
+}
+
+auto solve_part1(const auto& input) {
+  return std::ranges::fold_left(input.front(), std::pair<Coord, Coord>{},
+                                [](const auto& acc, const Growth& growth) {
+                                  const auto new_height = acc.first + vertical_growth(growth);
+                                  return std::make_pair(new_height,
+                                                        std::max(new_height, acc.second));
+                                })
+      .second;
+}
+
+using Loc = std::array<Coord, 3>;
+
+auto operator+(const Loc& a, const Loc& b) -> Loc {
+  Loc result;
+  std::ranges::transform(a, b, result.begin(), [](const Coord a_coord, const Coord b_coord) {
+    return a_coord + b_coord;
+  });
+  return result;
+}
+
+auto base_vector(const Direction direction) -> Loc {
+  switch (direction) {
+    case Direction::u:
+      return {0, 0, 1};
+    case Direction::d:
+      return {0, 0, -1};
+    case Direction::l:
+      return {0, -1, 0};
+    case Direction::r:
+      return {0, 1, 0};
+    case Direction::f:
+      return {1, 0, 0};
+    case Direction::b:
+      return {-1, 0, 0};
+  }
+  std::unreachable();
+}
+
+// Locations of the tree, kept in the ordered sets of the first implementation by the reference.
+// Otherwise, coordinates are packed into 21 bits each, so that building the tree throws when a
+// plant grows more than 2^20 units away from the base.
+template <common::Engine engine>
+using LocSet =
+    std::conditional_t<engine == common::Engine::reference, std::set<Loc>, common::CoordSet<Loc>>;
+
+template <common::Engine engine>
+struct Tree {
+  LocSet<engine> segments;
+  LocSet<engine> leaves;
+
+  static auto from_input(const auto& input) -> Tree;
+};
+
+template <common::Engine engine>
+auto Tree<engine>::from_input(const auto& input) -> Tree {
+  Tree result;
+
+  for (const auto& plant : input) {
+    Loc loc{};
+    for (const Growth& growth : plant) {
+      const auto base = base_vector(growth.direction);
+      for (const auto& _ : std::views::iota(Coord{0}, growth.length)) {
+        loc = loc + base;
+        result.segments.insert(loc);
+      }
+    }
+    result.leaves.insert(loc);
+  }
+
+  return result;
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return Tree<engine>::from_input(input).segments.size();
+}
+
+// The scratch containers are allocated from `resource`
+auto murkiness(const Tree<common::Engine::optimized>& tree, const Loc& start,
+               std::pmr::memory_resource* const resource) -> Coord {
+  PROFILE_SCOPE("quest14 murkiness");
+
+  Coord result{};
+
+  common::CoordSet<Loc> explored{{start}, resource};
+  std::pmr::vector<Loc> front{{start}, resource};
+  std::pmr::vector<Loc> next_front{resource};
+
+  std::size_t explored_leaves_count{};
+  if (tree.leaves.contains(start)) {
+    ++explored_leaves_count;
+  }
+
+  Coord distance{1};
+  while (tree.leaves.size() != explored_leaves_count) {
+    PROFILE_COUNT("quest14 frontier size", front.size());
+    next_front.clear();
+
+    for (const Loc& current : front) {
+      for (const Direction dir : all_directions) {
+        const Loc next = current + base_vector(dir);
+        if (tree.segments.contains(next)) {
+          if (explored.insert(next)) {
+            next_front.push_back(next);
+
+            if (tree.leaves.contains(next)) {
+              result += distance;
+              ++explored_leaves_count;
+            }
+          }
+        }
+      }
+    }
+
+    std::swap(front, next_front);
+    ++distance;
+  }
+
+  return result;
+}
+
+// Former search, with a set of the explored locations ordered as the tree
+auto reference_murkiness(const Tree<common::Engine::reference>& tree, const Loc& start) -> Coord {
+  Coord result{};
+
+  std::set<Loc> explored{start};
+  std::vector<Loc> front{start};
+
+  std::size_t explored_leaves_count{};
+  if (tree.leaves.contains(start)) {
+    ++explored_leaves_count;
+  }
+
+  Coord distance{1};
+  while (tree.leaves.size() != explored_leaves_count) {
+    std::vector<Loc> next_front;
+
+    for (const Loc& current : front) {
+      for (const Direction dir : all_directions) {
+        const Loc next = current + base_vector(dir);
+        if (tree.segments.contains(next)) {
+          if (explored.insert(next).second) {
+            next_front.push_back(next);
+
+            if (tree.leaves.contains(next)) {
+              result += distance;
+              ++explored_leaves_count;
+            }
+          }
+        }
+      }
+    }
+
+    front = std::move(next_front);
+    ++distance;
+  }
+
+  return result;
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  const auto tree = Tree<engine>::from_input(input);
+
+  const auto main_trunk = std::views::filter(tree.segments, [](const Loc& candidate) {
+                            return candidate[0] == Coord{} && candidate[1] == Coord{};
+                          }) |
+                          std::ranges::to<std::vector>();
+
+  if constexpr (engine == common::Engine::reference) {
+    return std::ranges::min(std::views::transform(
+        main_trunk, [&](const Loc& trunk) { return reference_murkiness(tree, trunk); }));
+  } else {
+    // A trunk is a few dozen segments, each of which is a whole search, so every one is a task
+    std::vector<Coord> murkinesses(main_trunk.size());
+    common::parallel_for(0UZ, main_trunk.size(), [&](const std::size_t rank) {
+      // The scratch memory of every murkiness computation is bumped into its own arena
+      std::pmr::monotonic_buffer_resource arena;
+      murkinesses[rank] = murkiness(tree, main_trunk[rank], &arena);
+    });
+    return std::ranges::min(murkinesses);
+  }
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest14",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
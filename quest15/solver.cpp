@@ -0,0 +1,412 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/arena.hpp"
+#include "common/external_bfs.hpp"
+#include "common/grid.hpp"
+#include "common/hash.hpp"
+#include "common/line_chunks.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+#include "common/resident.hpp"
+#include "common/text.hpp"
+
+namespace {
+
+using common::Coord;
+using common::Loc;
+
+using Herb = char;
+using Grid = common::Grid<char>;
+
+constexpr char open_tile = '.';
+constexpr char wall_tile = '#';
+
+struct Forest {  // NOLINT(cppcoreguidelines-pro-type-member-init)
+  Grid tiles;
+  std::map<Loc, Herb> herbs;
+  Loc start;
+  // Raw map searched on disk instead of `tiles`, which is then empty
+  std::optional<common::TextGrid> text;
+
+  auto herb(const Loc& loc) const -> Herb { return text ? (*text)[text->index(loc)] : tiles[loc]; }
+};
+
+// Forest of which only the herbs are kept in memory, for the external-memory searches
+auto parse_text(const std::string_view input) -> Forest {
+  Forest result{.tiles = {}, .herbs = {}, .start = {}, .text = common::TextGrid{input}};
+
+  Coord i{};
+  for (const std::string_view row : common::lines(input)) {
+    for (const auto [j, c] : std::views::enumerate(row)) {
+      const Loc loc{i, Coord(j)};
+      if (c == open_tile && i == Coord{}) {
+        result.start = loc;
+      } else if (std::isalpha(c) != 0) {
+        result.herbs.emplace(loc, c);
+      }
+    }
+    ++i;
+  }
+
+  return result;
+}
+
+auto parse_input(const std::string_view input) -> Forest {
+  if (common::external_memory_settings().directory) {
+    return parse_text(input);
+  }
+
+  Forest result;
+
+  const auto chunks = common::split_lines(input);
+
+  result.tiles = Grid::from_chunks(chunks, wall_tile, [](const Loc& /*loc*/, const char c) {
+    if (c == open_tile) {
+      return open_tile;
+    }
+    return std::isalpha(c) != 0 ? c : wall_tile;
+  });
+
+  // Collected in row-major order, i.e. in the order of the map
+  using Entry = std::pair<Loc, Herb>;
+  const auto herbs = common::parallel_collect_lines<Entry>(
+      chunks, [](const std::size_t row, const std::string_view line, std::vector<Entry>& herbs) {
+        for (const auto [j, c] : std::views::enumerate(line)) {
+          if (std::isalpha(c) != 0) {
+            herbs.emplace_back(Loc{Coord(row), Coord(j)}, c);
+          }
+        }
+      });
+  for (const auto& herb : herbs) {
+    result.herbs.emplace_hint(result.herbs.end(), herb);
+  }
+
+  if (!chunks.chunks.empty()) {
+    const auto first_row = *common::lines(chunks.chunks.front().text).begin();
+    result.start = {Coord{}, Coord(first_row.rfind(open_tile))};
+  }
+
+  return result;
+}
+
+constexpr std::array<Loc, 4> moves{{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
+
+using PathLength = std::uint64_t;
+
+// The scratch containers are allocated from `resource`
+auto shortest_path_lengths(const Grid& tiles, const Loc start, const std::map<Loc, Herb>& targets,
+                           std::pmr::memory_resource* const resource)
+    -> std::map<Loc, PathLength> {
+  std::map<Loc, PathLength> result;
+
+  const auto offsets = tiles.offsets(moves);
+  std::pmr::vector<bool> explored(tiles.size(), false, resource);
+  explored[tiles.index(start)] = true;
+  std::pmr::vector<Grid::Index> front{{tiles.index(start)}, resource};
+  std::pmr::vector<Grid::Index> next_front{resource};
+
+  PathLength path_length{1};
+
+  while (!front.empty()) {
+    next_front.clear();
+
+    for (const Grid::Index current : front) {
+      for (const Grid::Offset offset : offsets) {
+        const Grid::Index next = current + offset;
+        if (tiles[next] != wall_tile && !explored[next]) {
+          explored[next] = true;
+          if (tiles[next] != open_tile) {
+            if (const Loc loc = tiles.loc(next); targets.contains(loc)) {
+              result.emplace(loc, path_length);
+            }
+          }
+          next_front.push_back(next);
+        }
+      }
+    }
+
+    if (result.size() == targets.size()) {
+      break;
+    }
+
+    ++path_length;
+    std::swap(front, next_front);
+  }
+
+  return result;
+}
+
+auto is_open(const char tile) { return tile == open_tile || std::isalpha(tile) != 0; }
+
+// Same as `shortest_path_lengths`, searching the raw map on disk
+auto external_shortest_path_lengths(const common::TextGrid& text, const Loc start,
+                                    const std::map<Loc, Herb>& targets)
+    -> std::map<Loc, PathLength> {
+  std::map<Loc, PathLength> result;
+
+  common::external_bfs(
+      text, moves, {text.index(start)}, is_open,
+      [&](const common::TextGrid::Index index, const std::size_t distance) {
+        if (distance != 0UZ && text[index] != open_tile) {
+          if (const Loc loc = text.loc(index); targets.contains(loc)) {
+            result.emplace(loc, PathLength{distance});
+          }
+        }
+      },
+      [&]() { return result.size() == targets.size(); });
+
+  return result;
+}
+
+auto path_lengths(const Forest& forest, const Loc start, const std::map<Loc, Herb>& targets,
+                  std::pmr::memory_resource* const resource) -> std::map<Loc, PathLength> {
+  if (forest.text) {
+    return external_shortest_path_lengths(*forest.text, start, targets);
+  }
+  return shortest_path_lengths(forest.tiles, start, targets, resource);
+}
+
+auto operator+(const Loc& a, const Loc& b) -> Loc { return {a[0] + b[0], a[1] + b[1]}; }
+
+// Open tiles of the forest, in the ordered set of the first implementation
+auto reference_open_tiles(const Forest& forest) -> std::set<Loc> {
+  std::set<Loc> result;
+  if (forest.text) {
+    const common::TextGrid& text = *forest.text;
+    for (common::TextGrid::Index index = 0UZ; index < text.text().size(); ++index) {
+      if (is_open(text[index])) {
+        result.insert(text.loc(index));
+      }
+    }
+  } else {
+    for (const Grid::Index index : forest.tiles.indices()) {
+      if (forest.tiles[index] != wall_tile) {
+        result.insert(forest.tiles.loc(index));
+      }
+    }
+  }
+  return result;
+}
+
+// Former search, with a set of the explored locations
+auto reference_shortest_path_lengths(const std::set<Loc>& open_tiles, const Loc start,
+                                     const std::map<Loc, Herb>& targets)
+    -> std::map<Loc, PathLength> {
+  std::map<Loc, PathLength> result;
+
+  std::set<Loc> explored{start};
+  std::vector<Loc> front{start};
+
+  PathLength path_length{1};
+
+  while (!front.empty()) {
+    std::vector<Loc> next_front;
+
+    for (const Loc& current : front) {
+      for (const Loc& move : moves) {
+        const Loc next = current + move;
+        if (open_tiles.contains(next) && explored.insert(next).second) {
+          if (const auto it = targets.find(next); it != targets.end()) {
+            result.emplace(next, path_length);
+          }
+          next_front.push_back(next);
+        }
+      }
+    }
+
+    if (result.size() == targets.size()) {
+      break;
+    }
+
+    ++path_length;
+    front = std::move(next_front);
+  }
+
+  return result;
+}
+
+using Edges = std::multimap<Loc, std::pair<Loc, PathLength>>;
+
+void fill_edges(Edges& edges, const Loc origin, const std::map<Loc, PathLength>& ends) {
+  for (const auto& end : ends) {
+    edges.emplace(origin, end);
+  }
+}
+
+void fill_reciprocal_edges(Edges& edges, const Loc origin, const std::map<Loc, PathLength>& ends) {
+  for (const auto& end : ends) {
+    edges.emplace(end.first, std::make_pair(origin, end.second));
+  }
+}
+
+// Edges between the start and the herbs, of which `path_lengths(start, targets)` finds the lengths
+auto compressed_paths(const Forest& forest, const auto& path_lengths) -> Edges {
+  Edges result;
+
+  fill_edges(result, forest.start, path_lengths(forest.start, forest.herbs));
+
+  const auto all_herbs = std::views::values(forest.herbs) | std::ranges::to<std::set>();
+  for (const auto herb : all_herbs) {
+    const auto starts =
+        std::views::filter(forest.herbs, [&](const auto& pair) { return pair.second == herb; }) |
+        std::views::keys | std::ranges::to<std::vector>();
+    const auto targets =
+        std::views::filter(forest.herbs, [&](const auto& pair) { return pair.second > herb; }) |
+        std::ranges::to<std::map>();
+    for (const Loc& start : starts) {
+      const auto ends = path_lengths(start, targets);
+      fill_edges(result, start, ends);
+      fill_reciprocal_edges(result, start, ends);
+    }
+  }
+
+  return result;
+}
+
+auto herb_type_count(const Forest& forest) -> std::size_t {
+  const auto all_herbs = std::views::values(forest.herbs) | std::ranges::to<std::set>();
+  return all_herbs.size();
+}
+
+using HerbSet = std::uint32_t;
+
+auto herb_code(const Herb herb) -> HerbSet { return 1U << (herb - 'A'); }
+
+auto contains(const HerbSet& herb_set, const Herb herb) {
+  return (herb_set & herb_code(herb)) != 0U;
+}
+
+auto insert(const HerbSet& herb_set, const Herb herb) { return herb_set | herb_code(herb); }
+
+struct Status {  // NOLINT(cppcoreguidelines-pro-type-member-init)
+  Loc loc;
+  HerbSet collected_herbs{};
+
+  constexpr auto operator<=>(const Status&) const noexcept = default;
+};
+
+// Hash of the map of the forest, which determines its herbs and its start
+auto forest_hash(const Forest& forest) -> std::uint64_t {
+  if (forest.text) {
+    return common::hash_bytes(forest.text->text());
+  }
+  const auto& tiles = forest.tiles.tiles();
+  return common::hash_bytes({tiles.data(), tiles.size()}, std::uint64_t(forest.tiles.col_count()));
+}
+
+// The edges of the optimized engine stay resident in a long-running process, as they take most of
+// the time of a part and only depend on the map
+template <common::Engine engine>
+auto edges_of(const Forest& forest, std::pmr::memory_resource* const resource)
+    -> std::shared_ptr<const Edges> {
+  if constexpr (engine == common::Engine::reference) {
+    const auto open_tiles = reference_open_tiles(forest);
+    return std::make_shared<const Edges>(
+        compressed_paths(forest, [&](const Loc start, const std::map<Loc, Herb>& targets) {
+          return reference_shortest_path_lengths(open_tiles, start, targets);
+        }));
+  } else {
+    return common::resident_store().get<Edges>(forest_hash(forest), [&] {
+      return compressed_paths(forest, [&](const Loc start, const std::map<Loc, Herb>& targets) {
+        return path_lengths(forest, start, targets, resource);
+      });
+    });
+  }
+}
+
+template <common::Engine engine>
+auto solve(const Forest& forest) {
+  PROFILE_SCOPE("quest15 solve");
+
+  common::Arena arena;
+  // The reference allocates everything from the heap, as the first implementation
+  std::pmr::memory_resource* const resource =
+      engine == common::Engine::reference ? std::pmr::new_delete_resource() : &arena;
+  const auto resident_edges = edges_of<engine>(forest, resource);
+  const Edges& edges = *resident_edges;
+
+  // The states of a round reuse the memory of the ones of the round before
+  std::pmr::map<Status, PathLength> front{
+      {{{.loc = forest.start, .collected_herbs = {}}, 0}}, resource};
+  for (auto _ : std::views::iota(0UZ, herb_type_count(forest))) {
+    PROFILE_COUNT("quest15 states", front.size());
+    std::pmr::map<Status, PathLength> new_front{resource};
+
+    for (const auto& [current_status, current_length] : front) {
+      const auto& [current_loc, current_herbs] = current_status;
+      const auto candidate_range = edges.equal_range(current_loc);
+      for (const auto& [candidate_loc, candidate_length_delta] : std::views::values(
+               std::ranges::subrange(candidate_range.first, candidate_range.second))) {
+        const Herb new_herb = forest.herb(candidate_loc);
+        if (!contains(current_herbs, new_herb)) {
+          const auto next_herbs = insert(current_herbs, new_herb);
+          const auto next_length = current_length + candidate_length_delta;
+          const auto [it, inserted] = new_front.emplace(
+              Status{.loc = candidate_loc, .collected_herbs = next_herbs}, next_length);
+          if (!inserted) {
+            it->second = std::min(it->second, next_length);
+          }
+        }
+      }
+    }
+
+    front = std::move(new_front);
+  }
+
+  return std::ranges::min(std::views::transform(front, [&](const auto& entry) {
+    const auto& [status, path_length] = entry;
+    const auto loc = status.loc;
+    const auto candidate_edges = edges.equal_range(forest.start);
+    const auto range = std::ranges::subrange(candidate_edges.first, candidate_edges.second);
+    const auto it =
+        std::ranges::find_if(range, [&](const auto& entry) { return entry.second.first == loc; });
+    return path_length + it->second.second;
+  }));
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  return solve<engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return solve<engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  return solve<engine>(input);
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest15",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
@@ -1,21 +1,24 @@
 #include <algorithm>
 #include <array>
-#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <format>
-#include <fstream>
-#include <ios>
-#include <istream>
 #include <iterator>
 #include <map>
+#include <memory_resource>
 #include <numeric>
-#include <print>
 #include <ranges>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "common/arena.hpp"
+#include "common/quest.hpp"
+#include "common/text.hpp"
+
+namespace {
+
 using CatFace = std::array<char, 3>;
 
 using Offset = std::int32_t;
@@ -44,19 +47,17 @@ struct Wheel {
 
 using Input = std::vector<Wheel>;
 
-auto parse_input(std::istream&& in) {
-  auto data = std::views::istream<char>(in >> std::noskipws);
-  auto lines = std::views::lazy_split(data, '\n');
+auto parse_input(const std::string_view input) {
+  const auto lines = common::lines(input);
   auto line_it = lines.begin();
 
-  Input result = *line_it | std::views::lazy_split(',') | std::views::transform([](auto&& rng) {
-    const auto token = rng | std::ranges::to<std::vector>();
-    std::size_t step_size;  // NOLINT(cppcoreguidelines-init-variables)
-    std::from_chars(token.data(), std::next(token.data(), token.size()), step_size);
-    return Wheel{.faces = {}, .step_size = step_size};
-  }) | std::ranges::to<std::vector>();
+  Input result = common::fields<','>(*line_it) |
+                 std::views::transform([](const std::string_view token) {
+                   return Wheel{.faces = {}, .step_size = common::to_number<std::size_t>(token)};
+                 }) |
+                 std::ranges::to<std::vector>();
 
-  for (auto&& line : std::ranges::subrange(std::ranges::next(line_it), lines.end())) {
+  for (const std::string_view line : std::ranges::subrange(std::next(line_it), lines.end())) {
     auto tokens = line | std::views::chunk(4) |
                   std::views::transform([](auto&& rng) { return rng | std::views::take(3); });
     for (auto&& [token, dst] : std::views::zip(tokens, result)) {
@@ -91,8 +92,18 @@ auto machine_period(const Input& wheels) -> std::size_t {
   });
 }
 
+// The reference allocates the scratch containers from the heap, as the first implementation
+template <common::Engine engine>
+auto scratch_resource(std::pmr::memory_resource* const arena) -> std::pmr::memory_resource* {
+  return engine == common::Engine::reference ? std::pmr::new_delete_resource() : arena;
+}
+
+template <common::Engine engine>
 auto bytes_earned(const Input& wheels, const std::size_t pull_rank, const Offset offset) {
-  std::map<char, std::size_t> counts;
+  // The counts are bumped into a buffer on the stack, which fits a few dozen symbols
+  std::array<std::byte, 2048UZ> buffer;  // NOLINT(cppcoreguidelines-pro-type-member-init)
+  std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+  std::pmr::map<char, std::size_t> counts{scratch_resource<engine>(&arena)};
   for (char c : sequence(wheels, pull_rank, offset) | std::views::stride(2)) {
     ++counts[c];
   }
@@ -103,10 +114,12 @@ auto bytes_earned(const Input& wheels, const std::size_t pull_rank, const Offset
                                 });
 }
 
+template <common::Engine engine>
 auto bytes_earned(const Input& wheels, const std::size_t pull_rank) {
-  return bytes_earned(wheels, pull_rank, 0);
+  return bytes_earned<engine>(wheels, pull_rank, 0);
 }
 
+template <common::Engine engine = common::Engine::optimized>
 auto solve_part2(const auto& input) {
   constexpr std::size_t pull_count = 202420242024UZ;
 
@@ -117,30 +130,36 @@ auto solve_part2(const auto& input) {
   const std::size_t remainder_earnings =
       std::ranges::fold_left(std::views::iota(0UZ, remainder), 0UZ,
                              [&](const std::size_t acc, const std::size_t pull_rank) {
-                               return acc + bytes_earned(input, pull_rank);
+                               return acc + bytes_earned<engine>(input, pull_rank);
                              });
 
   const std::size_t period_earnings =
       std::ranges::fold_left(std::views::iota(remainder, period), remainder_earnings,
                              [&](const std::size_t acc, const std::size_t pull_rank) {
-                               return acc + bytes_earned(input, pull_rank);
+                               return acc + bytes_earned<engine>(input, pull_rank);
                              });
 
   return (period_earnings * full_period_count) + remainder_earnings;
 }
 
+template <common::Engine engine = common::Engine::optimized>
 auto solve_part3(const auto& input) {
-  std::map<Offset, std::pair<std::size_t, std::size_t>> extreme_earnings{{0, {0UZ, 0UZ}}};
+  using Earnings = std::pmr::map<Offset, std::pair<std::size_t, std::size_t>>;
+
+  // The earnings of a pull reuse the memory of the ones of the pull before
+  common::Arena arena;
+  std::pmr::memory_resource* const resource = scratch_resource<engine>(&arena);
+  Earnings extreme_earnings{{{0, {0UZ, 0UZ}}}, resource};
 
   for (auto pull_count : std::views::iota(0UZ, 256UZ)) {
     const std::size_t pull_rank = pull_count + 1UZ;
-    std::map<Offset, std::pair<std::size_t, std::size_t>> next_extreme_earnings;
+    Earnings next_extreme_earnings{resource};
 
     for (const auto& [offset, values] : extreme_earnings) {
       const auto& [best, worst] = values;
       for (auto delta : std::array<Offset, 3>{{-1, 0, 1}}) {
         const Offset next_offset = offset + delta;
-        const std::size_t new_earning = bytes_earned(input, pull_rank, next_offset);
+        const std::size_t new_earning = bytes_earned<engine>(input, pull_rank, next_offset);
         const std::size_t candidate_best = best + new_earning;
         const std::size_t candidate_worst = worst + new_earning;
         const auto [it, inserted] = next_extreme_earnings.emplace(
@@ -164,16 +183,20 @@ auto solve_part3(const auto& input) {
   return std::format("{} {}", best_earning, worst_earning);
 }
 
-auto main() -> int {
-  const auto input1 = parse_input(std::ifstream{"input1.txt"});
-  const auto answer1 = solve_part1(input1);
-  std::println("The answer to part #1 is {}", answer1);
-
-  const auto input2 = parse_input(std::ifstream{"input2.txt"});
-  const auto answer2 = solve_part2(input2);
-  std::println("The answer to part #2 is {}", answer2);
-
-  const auto input3 = parse_input(std::ifstream{"input3.txt"});
-  const auto answer3 = solve_part3(input3);
-  std::println("The answer to part #3 is {}", answer3);
-}
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest16",
+    .parts = {
+        common::make_part({"input1.txt"}, parse,
+                          [](const auto& input) { return solve_part1(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
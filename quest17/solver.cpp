@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/coord_set.hpp"
+#include "common/line_chunks.hpp"
+#include "common/parallel.hpp"
+#include "common/quest.hpp"
+
+namespace {
+
+using Coord = std::int32_t;
+using Loc = std::array<Coord, 2>;
+
+auto parse_input(const std::string_view input) {
+  return common::parallel_collect_lines<Loc>(
+      common::split_lines(input),
+      [](const std::size_t row, const std::string_view line, std::vector<Loc>& stars) {
+        for (std::size_t col = line.find('*'); col != std::string_view::npos;
+             col = line.find('*', col + 1UZ)) {
+          stars.push_back({Coord(row), Coord(col)});
+        }
+      });
+}
+
+auto distance(const Loc& a, const Loc& b) { return std::abs(a[0] - b[0]) + std::abs(a[1] - b[1]); }
+
+using Edge = std::array<Loc, 2>;
+
+auto length(const Edge& edge) { return distance(edge[0], edge[1]); }
+
+auto constellation_size(const std::span<const Edge> constellation) {
+  return std::ranges::fold_left(
+             std::views::transform(constellation, [](const Edge& edge) { return length(edge); }),
+             Coord{}, std::plus<>{}) +
+         Coord(constellation.size() + 1UZ);
+}
+
+auto constellation_basis(const std::span<const Loc> stars) -> std::vector<Edge> {
+  // Edge to the nearest star of every star, provided that it is unique
+  std::vector<std::optional<Edge>> nearest_edges(stars.size());
+  common::parallel_for(0UZ, stars.size(), [&](const std::size_t rank) {
+    const Loc& star = stars[rank];
+    auto candidates =
+        std::views::filter(stars, [&](const Loc& other_star) { return other_star != star; }) |
+        std::views::transform([&](const Loc& other_star) {
+          return std::make_pair(other_star, distance(star, other_star));
+        }) |
+        std::ranges::to<std::vector>();
+    std::ranges::sort(candidates, {}, [](const auto& candidate) { return candidate.second; });
+    if (candidates[0].second < candidates[1].second) {
+      const Loc& other_star = candidates[0].first;
+      nearest_edges[rank] = Edge{std::min(star, other_star), std::max(star, other_star)};
+    }
+  });
+
+  auto result = nearest_edges |
+                std::views::filter([](const auto& edge) { return edge.has_value(); }) |
+                std::views::transform([](const auto& edge) { return *edge; }) |
+                std::ranges::to<std::vector>();
+
+  std::ranges::sort(result);
+  const auto [removed_begin, removed_end] = std::ranges::unique(result);
+  result.erase(removed_begin, removed_end);
+
+  return result;
+}
+
+// Stars connected so far, kept in the ordered sets of the first implementation by the reference
+template <common::Engine engine>
+using StarGroup =
+    std::conditional_t<engine == common::Engine::reference, std::set<Loc>, common::CoordSet<Loc>>;
+
+template <typename StarGroup>
+auto find_star_group(std::vector<StarGroup>& groups, const Loc& star) {
+  return std::ranges::find_if(groups, [&](const auto& group) { return group.contains(star); });
+}
+
+template <typename StarGroup>
+auto merge_star_groups(std::vector<StarGroup>& groups, const Edge& new_edge) {
+  auto first = find_star_group(groups, new_edge[0]);
+  auto second = find_star_group(groups, new_edge[1]);
+  if (first != second) {
+    if (first->size() < second->size()) {
+      std::swap(*first, *second);
+    }
+    first->merge(std::move(*second));
+    *second = std::move(groups.back());
+    groups.pop_back();
+  }
+}
+
+template <typename StarGroup>
+auto compute_star_groups(const std::span<const Loc> stars, const std::span<const Edge> edges)
+    -> std::vector<StarGroup> {
+  std::vector<StarGroup> result =
+      std::views::transform(stars, [](const Loc& star) { return StarGroup{star}; }) |
+      std::ranges::to<std::vector>();
+
+  for (const Edge& edge : edges) {
+    merge_star_groups(result, edge);
+  }
+
+  return result;
+}
+
+auto all_edges(const std::span<const Loc> stars) {
+  return std::views::enumerate(stars) | std::views::transform([stars](const auto& pair) {
+           const auto& [rank, star] = pair;
+           return std::views::drop(stars, rank + 1UZ) |
+                  std::views::transform([star](const Loc& other_star) {
+                    return Edge{std::min(star, other_star), std::max(star, other_star)};
+                  });
+         }) |
+         std::views::join;
+}
+
+template <common::Engine engine>
+auto constellation_edges(const std::span<const Loc> stars) -> std::vector<Edge> {
+  if (stars.size() < 2UZ) {
+    return {};
+  }
+
+  std::vector<Edge> result = constellation_basis(stars);
+  auto groups = compute_star_groups<StarGroup<engine>>(stars, result);
+
+  while (result.size() != (stars.size() - 1UZ)) {
+    const Edge best_candidate = std::ranges::min(
+        all_edges(stars) | std::views::filter([&](const Edge& edge) {
+          return find_star_group(groups, edge[0]) != find_star_group(groups, edge[1]);
+        }),
+        {}, length);
+    merge_star_groups(groups, best_candidate);
+    result.push_back(best_candidate);
+  }
+
+  return result;
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  return constellation_size(constellation_edges<engine>(input));
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return constellation_size(constellation_edges<engine>(input));
+}
+
+template <common::Engine engine>
+auto partition_stars(const std::span<const Loc>& stars, const Coord threshold)
+    -> std::vector<StarGroup<engine>> {
+  const auto valid_edges =
+      all_edges(stars) |
+      std::views::filter([threshold](const Edge& edge) { return length(edge) < threshold; }) |
+      std::ranges::to<std::vector>();
+
+  return compute_star_groups<StarGroup<engine>>(stars, valid_edges);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  const auto partition = partition_stars<engine>(input, Coord{6});
+
+  auto brilliant_constellations_sizes =
+      std::views::transform(
+          partition,
+          [](const auto& stars) {
+            return constellation_size(
+                constellation_edges<engine>(std::ranges::to<std::vector>(stars)));
+          }) |
+      std::ranges::to<std::vector>();
+
+  std::ranges::nth_element(brilliant_constellations_sizes,
+                           std::next(brilliant_constellations_sizes.begin(), 3), std::greater<>{});
+  return std::reduce(brilliant_constellations_sizes.begin(),
+                     std::next(brilliant_constellations_sizes.begin(), 3), std::int64_t{1},
+                     std::multiplies<>{});
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest17",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace
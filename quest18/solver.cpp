@@ -0,0 +1,473 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <set>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "common/arena.hpp"
+#include "common/external_bfs.hpp"
+#include "common/grid.hpp"
+#include "common/line_chunks.hpp"
+#include "common/parallel.hpp"
+#include "common/profile.hpp"
+#include "common/quest.hpp"
+
+namespace {
+
+using common::Coord;
+using common::Loc;
+
+enum class Tile : std::uint8_t {
+  wall,
+  open,
+  palm_tree,
+};
+
+using Grid = common::Grid<Tile>;
+
+struct Farm {
+  Grid tiles;
+  std::vector<Grid::Index> open_tiles;
+  std::vector<Grid::Index> palm_trees;
+  // Raw map searched on disk instead of `tiles`, which is then empty, and indexing `palm_trees`
+  std::optional<common::TextGrid> text;
+};
+
+// Farm of which only the palm trees are kept in memory, for the external-memory searches
+auto parse_text(const std::string_view input) -> Farm {
+  Farm result{.tiles = {}, .open_tiles = {}, .palm_trees = {}, .text = common::TextGrid{input}};
+  for (std::size_t index = input.find('P'); index != std::string_view::npos;
+       index = input.find('P', index + 1UZ)) {
+    result.palm_trees.push_back(index);
+  }
+  return result;
+}
+
+auto parse_input(const std::string_view input) -> Farm {
+  if (common::external_memory_settings().directory) {
+    return parse_text(input);
+  }
+
+  Farm result;
+
+  const auto chunks = common::split_lines(input);
+
+  result.tiles = Grid::from_chunks(chunks, Tile::wall, [](const Loc& /*loc*/, const char c) {
+    switch (c) {
+      case 'P':
+        return Tile::palm_tree;
+      case '.':
+        return Tile::open;
+      default:
+        return Tile::wall;
+    }
+  });
+
+  const auto collect_indices = [&](const std::string_view tiles) {
+    return common::parallel_collect_lines<Grid::Index>(
+        chunks, [&](const std::size_t row, const std::string_view line,
+                    std::vector<Grid::Index>& indices) {
+          const Grid::Index first_index = result.tiles.index({Coord(row), Coord{}});
+          for (std::size_t col = line.find_first_of(tiles); col != std::string_view::npos;
+               col = line.find_first_of(tiles, col + 1UZ)) {
+            indices.push_back(first_index + col);
+          }
+        });
+  };
+  result.open_tiles = collect_indices(".P");
+  result.palm_trees = collect_indices("P");
+
+  return result;
+}
+
+auto starting_locations(const Farm& farm) -> std::vector<Grid::Index> {
+  const Loc bounds{farm.tiles.row_count() - 1, farm.tiles.col_count() - 1};
+  return std::views::filter(farm.open_tiles,
+                            [&](const Grid::Index index) {
+                              const Loc loc = farm.tiles.loc(index);
+                              return loc[0] == Coord{} || loc[0] == bounds[0] ||
+                                     loc[1] == Coord{0} || loc[1] == bounds[1];
+                            }) |
+         std::ranges::to<std::vector>();
+}
+
+constexpr std::array<Loc, 4> moves{{{-1, 0}, {1, 0}, {0, -1}, {0, 1}}};
+
+auto furthest_tree(const Farm& farm) {
+  PROFILE_SCOPE("quest18 furthest_tree");
+
+  Coord result{};
+
+  const auto offsets = farm.tiles.offsets(moves);
+  std::vector<Grid::Index> front = starting_locations(farm);
+  std::vector<bool> explored(farm.tiles.size(), false);
+  for (const Grid::Index index : front) {
+    explored[index] = true;
+  }
+  std::vector<Grid::Index> next_front;
+  std::size_t tree_count{};
+
+  while (tree_count < farm.palm_trees.size()) {
+    PROFILE_COUNT("quest18 frontier size", front.size());
+    next_front.clear();
+
+    for (const Grid::Index index : front) {
+      for (const Grid::Offset offset : offsets) {
+        const Grid::Index candidate = index + offset;
+        if (farm.tiles[candidate] != Tile::wall && !explored[candidate]) {
+          explored[candidate] = true;
+          next_front.push_back(candidate);
+          if (farm.tiles[candidate] == Tile::palm_tree) {
+            ++tree_count;
+          }
+        }
+      }
+    }
+
+    std::swap(front, next_front);
+    ++result;
+  }
+
+  return result;
+}
+
+auto is_open(const char tile) { return tile == '.' || tile == 'P'; }
+
+// Same as `furthest_tree`, searching the raw map on disk
+auto external_furthest_tree(const Farm& farm) -> Coord {
+  PROFILE_SCOPE("quest18 external_furthest_tree");
+
+  const auto& text = *farm.text;
+  std::vector<common::TextGrid::Index> starts;
+  for (const Coord i : std::views::iota(Coord{}, text.row_count())) {
+    for (const Coord j : std::views::iota(Coord{}, text.col_count())) {
+      const bool border = i == Coord{} || i == text.row_count() - 1 || j == Coord{} ||
+                          j == text.col_count() - 1;
+      if (border && is_open(text[text.index({i, j})])) {
+        starts.push_back(text.index({i, j}));
+      }
+    }
+  }
+
+  Coord result{};
+  std::size_t tree_count{};
+  common::external_bfs(
+      text, moves, std::move(starts), is_open,
+      [&](const common::TextGrid::Index index, const std::size_t distance) {
+        if (distance != 0UZ && text[index] == 'P') {
+          ++tree_count;
+        }
+        result = Coord(distance);
+      },
+      [&]() { return tree_count >= farm.palm_trees.size(); });
+
+  return result;
+}
+
+// Farm of the first implementation, with its tiles in sets ordered by location
+struct ReferenceFarm {
+  std::set<Loc> open_tiles;
+  std::set<Loc> palm_trees;
+  Loc bounds{};
+
+  static auto from_farm(const Farm& farm) -> ReferenceFarm;
+};
+
+auto ReferenceFarm::from_farm(const Farm& farm) -> ReferenceFarm {
+  ReferenceFarm result;
+
+  const auto add_tile = [&](const Loc& loc, const bool palm_tree) {
+    result.open_tiles.insert(loc);
+    if (palm_tree) {
+      result.palm_trees.insert(loc);
+    }
+  };
+  if (farm.text) {
+    const common::TextGrid& text = *farm.text;
+    result.bounds = {text.row_count() - 1, text.col_count() - 1};
+    for (common::TextGrid::Index index = 0UZ; index < text.text().size(); ++index) {
+      if (is_open(text[index])) {
+        add_tile(text.loc(index), text[index] == 'P');
+      }
+    }
+  } else {
+    result.bounds = {farm.tiles.row_count() - 1, farm.tiles.col_count() - 1};
+    for (const Grid::Index index : farm.tiles.indices()) {
+      if (farm.tiles[index] != Tile::wall) {
+        add_tile(farm.tiles.loc(index), farm.tiles[index] == Tile::palm_tree);
+      }
+    }
+  }
+
+  return result;
+}
+
+auto operator+(const Loc& a, const Loc& b) noexcept -> Loc { return {a[0] + b[0], a[1] + b[1]}; }
+
+// Former search, with a set of the explored locations
+auto reference_furthest_tree(const ReferenceFarm& farm) {
+  Coord result{};
+
+  std::vector<Loc> front =
+      std::views::filter(farm.open_tiles,
+                         [&](const Loc& loc) {
+                           return loc[0] == Coord{} || loc[0] == farm.bounds[0] ||
+                                  loc[1] == Coord{0} || loc[1] == farm.bounds[1];
+                         }) |
+      std::ranges::to<std::vector>();
+  std::set<Loc> explored{front.begin(), front.end()};
+  std::size_t tree_count{};
+
+  while (tree_count < farm.palm_trees.size()) {
+    std::vector<Loc> next_front;
+
+    for (const Loc& loc : front) {
+      for (const Loc& move : moves) {
+        const Loc candidate = loc + move;
+        if (farm.open_tiles.contains(candidate) && explored.insert(candidate).second) {
+          next_front.push_back(candidate);
+          if (farm.palm_trees.contains(candidate)) {
+            ++tree_count;
+          }
+        }
+      }
+    }
+
+    front = std::move(next_front);
+    ++result;
+  }
+
+  return result;
+}
+
+template <common::Engine engine>
+auto solve_furthest_tree(const Farm& farm) -> Coord {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_furthest_tree(ReferenceFarm::from_farm(farm));
+  } else {
+    return farm.text ? external_furthest_tree(farm) : furthest_tree(farm);
+  }
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part1(const auto& input) {
+  return solve_furthest_tree<engine>(input);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part2(const auto& input) {
+  return solve_furthest_tree<engine>(input);
+}
+
+// Distances from `start` to every tile, indexed like the tiles of the farm.
+// The scratch containers are allocated from `resource`.
+auto distances(const Farm& farm, const Grid::Index start, std::pmr::memory_resource* const resource)
+    -> std::vector<Coord> {
+  std::vector<Coord> result(farm.tiles.size());
+
+  const auto offsets = farm.tiles.offsets(moves);
+  std::pmr::vector<Grid::Index> front{{start}, resource};
+  std::pmr::vector<Grid::Index> next_front{resource};
+  std::pmr::vector<bool> explored(farm.tiles.size(), false, resource);
+  explored[start] = true;
+  Coord distance{};
+
+  while (!front.empty()) {
+    next_front.clear();
+    ++distance;
+
+    for (const Grid::Index index : front) {
+      for (const Grid::Offset offset : offsets) {
+        const Grid::Index candidate = index + offset;
+        if (farm.tiles[candidate] != Tile::wall && !explored[candidate]) {
+          explored[candidate] = true;
+          next_front.push_back(candidate);
+          result[candidate] = distance;
+        }
+      }
+    }
+
+    std::swap(front, next_front);
+  }
+
+  return result;
+}
+
+// Minimum over the open tiles of the sum of their distances to the palm trees, as `solve_part3`,
+// searching the raw map on disk. The sums are kept in a run sorted by tile index, which the tiles
+// reached from every palm tree are merged into, once sorted by index too.
+auto external_min_summed_distance(const Farm& farm) -> Coord {
+  PROFILE_SCOPE("quest18 external_min_summed_distance");
+
+  using Index = common::TextGrid::Index;
+  struct Sum {
+    Index index;
+    Coord value;
+
+    auto operator<=>(const Sum&) const = default;
+  };
+
+  const auto& text = *farm.text;
+  const auto& settings = common::external_memory_settings();
+  const auto& directory = settings.directory.value();
+
+  common::Run<Sum> sums{directory};
+  for (const Index tree : farm.palm_trees) {
+    common::RunSorter<Sum> tree_distances{directory, settings.memory_budget / sizeof(Sum)};
+    common::external_bfs(
+        text, moves, {tree}, is_open,
+        [&](const Index index, const std::size_t distance) {
+          tree_distances.push({.index = index, .value = Coord(distance)});
+        },
+        []() { return false; });
+
+    common::Run<Sum> next_sums{directory};
+    sums.rewind();
+    auto sum = sums.next();
+    tree_distances.merge([&](const Sum& tree_distance) {
+      for (; sum && sum->index < tree_distance.index; sum = sums.next()) {
+        next_sums.push(*sum);
+      }
+      if (sum && sum->index == tree_distance.index) {
+        next_sums.push({.index = sum->index, .value = Coord(sum->value + tree_distance.value)});
+        sum = sums.next();
+      } else {
+        next_sums.push(tree_distance);
+      }
+    });
+    for (; sum; sum = sums.next()) {
+      next_sums.push(*sum);
+    }
+    sums = std::move(next_sums);
+  }
+
+  // The open tiles out of reach of every palm tree have a sum of zero
+  std::optional<Coord> result;
+  sums.rewind();
+  auto sum = sums.next();
+  for (Index index = 0UZ; index < text.text().size(); ++index) {
+    if (text[index] != '.') {
+      continue;
+    }
+    while (sum && sum->index < index) {
+      sum = sums.next();
+    }
+    const Coord candidate = sum && sum->index == index ? sum->value : Coord{};
+    result = std::min(result.value_or(candidate), candidate);
+  }
+  return result.value();
+}
+
+// Former distances, indexed like the open tiles in their set, which also stops on the tiles out of
+// reach of `start`
+auto reference_distances(const ReferenceFarm& farm, const Loc& start) -> std::vector<Coord> {
+  std::vector<Coord> result(farm.open_tiles.size());
+
+  std::vector<Loc> front{start};
+  std::set<Loc> explored{front.begin(), front.end()};
+  Coord distance{};
+
+  while (explored.size() < farm.open_tiles.size() && !front.empty()) {
+    std::vector<Loc> next_front;
+    ++distance;
+
+    for (const Loc& loc : front) {
+      for (const Loc& move : moves) {
+        const Loc candidate = loc + move;
+        if (const auto it = farm.open_tiles.find(candidate);
+            it != farm.open_tiles.end() && explored.insert(candidate).second) {
+          next_front.push_back(candidate);
+          result[std::distance(farm.open_tiles.begin(), it)] = distance;
+        }
+      }
+    }
+
+    front = std::move(next_front);
+  }
+
+  return result;
+}
+
+auto reference_min_summed_distance(const ReferenceFarm& farm) -> Coord {
+  const auto tree_distances =
+      std::views::transform(farm.palm_trees,
+                            [&](const Loc& tree) { return reference_distances(farm, tree); }) |
+      std::ranges::to<std::vector>();
+
+  const auto summed_tree_distances = std::ranges::fold_left(
+      tree_distances, std::vector<Coord>(farm.open_tiles.size()), [](auto&& acc, const auto& x) {
+        for (auto&& [src, dst] : std::views::zip(x, acc)) {
+          dst += src;
+        }
+        return acc;
+      });
+
+  auto candidates = std::views::zip(farm.open_tiles, summed_tree_distances) |
+                    std::views::filter([&](const auto& pair) {
+                      return !farm.palm_trees.contains(std::get<0>(pair));
+                    }) |
+                    std::views::elements<1>;
+
+  return std::ranges::min(candidates);
+}
+
+auto min_summed_distance(const Farm& input) -> Coord {
+  std::vector<std::vector<Coord>> tree_distances(input.palm_trees.size());
+  common::parallel_for(0UZ, input.palm_trees.size(), [&](const std::size_t rank) {
+    common::Arena arena;
+    tree_distances[rank] = distances(input, input.palm_trees[rank], &arena);
+  });
+
+  const auto summed_tree_distances = std::ranges::fold_left(
+      tree_distances, std::vector<Coord>(input.tiles.size()), [](auto&& acc, const auto& x) {
+        for (auto&& [src, dst] : std::views::zip(x, acc)) {
+          dst += src;
+        }
+        return acc;
+      });
+
+  auto candidates = std::views::filter(input.open_tiles,
+                                       [&](const Grid::Index index) {
+                                         return input.tiles[index] == Tile::open;
+                                       }) |
+                    std::views::transform(
+                        [&](const Grid::Index index) { return summed_tree_distances[index]; });
+
+  return std::ranges::min(candidates);
+}
+
+template <common::Engine engine = common::Engine::optimized>
+auto solve_part3(const auto& input) {
+  if constexpr (engine == common::Engine::reference) {
+    return reference_min_summed_distance(ReferenceFarm::from_farm(input));
+  } else {
+    return input.text ? external_min_summed_distance(input) : min_summed_distance(input);
+  }
+}
+
+auto parse(const common::Sources sources) { return parse_input(sources.front()); }
+
+[[maybe_unused]] const bool registered = common::register_quest({
+    .name = "quest18",
+    .parts = {
+        common::make_part(
+            {"input1.txt"}, parse, [](const auto& input) { return solve_part1(input); },
+            [](const auto& input) { return solve_part1<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input2.txt"}, parse, [](const auto& input) { return solve_part2(input); },
+            [](const auto& input) { return solve_part2<common::Engine::reference>(input); }),
+        common::make_part(
+            {"input3.txt"}, parse, [](const auto& input) { return solve_part3(input); },
+            [](const auto& input) { return solve_part3<common::Engine::reference>(input); }),
+    },
+});
+
+}  // namespace